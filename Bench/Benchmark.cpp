@@ -0,0 +1,152 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "Benchmark.h"
+
+BenchmarkRunner::BenchmarkRunner() :
+    m_sampleCount(30), m_warmupCount(3), m_filter(), m_label(), m_results()
+{
+}
+
+void BenchmarkRunner::Run(
+    const std::string &name,
+    const std::function<void()> &run,
+    const std::function<void()> &setup,
+    int opCount, size_t byteCount)
+{
+    if (m_filter.empty() == false && name.find(m_filter) == std::string::npos)
+        return;
+
+    std::cerr << "Benchmark " << name << std::endl;
+
+    for (int i = 0; i < m_warmupCount; i++)
+    {
+        if (setup) setup();
+        run();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(m_sampleCount);
+    for (int i = 0; i < m_sampleCount; i++)
+    {
+        if (setup) setup();
+
+        const Uint64 begin = Profiler::GetCounter();
+        run();
+        const Uint64 end = Profiler::GetCounter();
+
+        samples.push_back(Profiler::CounterToMS(end - begin));
+    }
+
+    Result result;
+    result.name = name;
+    result.sampleCount = m_sampleCount;
+    result.opCount = std::max(1, opCount);
+    result.byteCount = byteCount;
+    result.stats = ComputeStats(samples);
+    m_results.push_back(result);
+}
+
+BenchmarkStats BenchmarkRunner::ComputeStats(std::vector<double> &samples)
+{
+    BenchmarkStats stats = { 0 };
+    if (samples.empty()) return stats;
+
+    std::sort(samples.begin(), samples.end());
+    const size_t count = samples.size();
+
+    double sum = 0.0;
+    for (double sample : samples)
+    {
+        sum += sample;
+    }
+    stats.meanMS = sum / (double)count;
+
+    double variance = 0.0;
+    for (double sample : samples)
+    {
+        variance += (sample - stats.meanMS) * (sample - stats.meanMS);
+    }
+    variance /= (double)std::max((size_t)1, count - 1);
+
+    stats.minMS = samples.front();
+    stats.maxMS = samples.back();
+    stats.medianMS = (count % 2) ?
+        samples[count / 2] :
+        0.5 * (samples[count / 2 - 1] + samples[count / 2]);
+    stats.p95MS = samples[std::min(count - 1, (size_t)(0.95 * (double)count))];
+    stats.stdDevMS = sqrt(variance);
+
+    return stats;
+}
+
+int BenchmarkRunner::WriteJSON(const std::string &path) const
+{
+    cJSON *json = cJSON_CreateObject();
+    AssertNew(json);
+
+    cJSON_AddStringToObject(json, "label", m_label.c_str());
+    cJSON_AddNumberToObject(json, "sampleCount", m_sampleCount);
+    cJSON_AddNumberToObject(json, "warmupCount", m_warmupCount);
+
+    cJSON *jsonResults = cJSON_AddArrayToObject(json, "benchmarks");
+    AssertNew(jsonResults);
+
+    for (const Result &result : m_results)
+    {
+        const BenchmarkStats &stats = result.stats;
+        cJSON *jsonResult = cJSON_CreateObject();
+        AssertNew(jsonResult);
+
+        cJSON_AddStringToObject(jsonResult, "name", result.name.c_str());
+        cJSON_AddNumberToObject(jsonResult, "samples", result.sampleCount);
+        cJSON_AddNumberToObject(jsonResult, "opCount", result.opCount);
+        cJSON_AddNumberToObject(jsonResult, "minMS", stats.minMS);
+        cJSON_AddNumberToObject(jsonResult, "maxMS", stats.maxMS);
+        cJSON_AddNumberToObject(jsonResult, "meanMS", stats.meanMS);
+        cJSON_AddNumberToObject(jsonResult, "medianMS", stats.medianMS);
+        cJSON_AddNumberToObject(jsonResult, "p95MS", stats.p95MS);
+        cJSON_AddNumberToObject(jsonResult, "stdDevMS", stats.stdDevMS);
+        cJSON_AddNumberToObject(
+            jsonResult, "nsPerOp", 1.0e6 * stats.medianMS / (double)result.opCount
+        );
+        if (result.byteCount > 0 && stats.medianMS > 0.0)
+        {
+            const double mbPerSecond =
+                (double)result.byteCount / (1024.0 * 1024.0) / (stats.medianMS / 1000.0);
+            cJSON_AddNumberToObject(jsonResult, "MBPerSecond", mbPerSecond);
+        }
+
+        cJSON_AddItemToArray(jsonResults, jsonResult);
+    }
+
+    char *str = cJSON_Print(json);
+    AssertNew(str);
+    cJSON_Delete(json);
+
+    int exitStatus = EXIT_SUCCESS;
+    if (path.empty())
+    {
+        std::cout << str << std::endl;
+    }
+    else
+    {
+        FILE *file = fopen(path.c_str(), "wb");
+        if (file)
+        {
+            fputs(str, file);
+            fclose(file);
+        }
+        else
+        {
+            std::cout << "ERROR - Write benchmark results " << path << std::endl;
+            exitStatus = EXIT_FAILURE;
+        }
+    }
+
+    cJSON_free(str);
+    return exitStatus;
+}
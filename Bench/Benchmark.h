@@ -0,0 +1,97 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "../GameEngine/GameEngine.h"
+
+/// @brief Rsum statistique des chantillons d'un benchmark (en millisecondes).
+struct BenchmarkStats
+{
+    double minMS;
+    double maxMS;
+    double meanMS;
+    double medianMS;
+    double p95MS;
+    double stdDevMS;
+};
+
+/// @brief Excute des benchmarks et crit leurs rsultats au format JSON.
+/// Chaque benchmark est excut plusieurs fois  vide, puis mesur sur
+/// un nombre fixe d'chantillons.
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner();
+    BenchmarkRunner(BenchmarkRunner const&) = delete;
+    BenchmarkRunner& operator=(BenchmarkRunner const&) = delete;
+
+    /// @brief Mesure une fonction.
+    /// @param name le nom du benchmark.
+    /// @param run la fonction mesure, appele une fois par chantillon.
+    /// @param setup fonction non mesure appele avant chaque chantillon (optionnelle).
+    /// @param opCount le nombre d'oprations effectues par un appel de run.
+    /// @param byteCount le nombre d'octets traits par un appel de run.
+    void Run(
+        const std::string &name,
+        const std::function<void()> &run,
+        const std::function<void()> &setup = nullptr,
+        int opCount = 1, size_t byteCount = 0
+    );
+
+    /// @brief Ecrit les rsultats au format JSON.
+    /// @param path le chemin du fichier, ou une chane vide pour la sortie standard.
+    /// @return EXIT_SUCCESS ou EXIT_FAILURE.
+    int WriteJSON(const std::string &path) const;
+
+    void SetSampleCount(int sampleCount);
+    void SetWarmupCount(int warmupCount);
+
+    /// @brief Ne lance que les benchmarks dont le nom contient le filtre.
+    void SetFilter(const std::string &filter);
+
+    /// @brief Dfinit l'tiquette crite dans les rsultats
+    /// (par exemple l'identifiant du commit mesur).
+    void SetLabel(const std::string &label);
+
+    static BenchmarkStats ComputeStats(std::vector<double> &samples);
+
+private:
+    struct Result
+    {
+        std::string name;
+        int sampleCount;
+        int opCount;
+        size_t byteCount;
+        BenchmarkStats stats;
+    };
+
+    int m_sampleCount;
+    int m_warmupCount;
+    std::string m_filter;
+    std::string m_label;
+    std::vector<Result> m_results;
+};
+
+inline void BenchmarkRunner::SetSampleCount(int sampleCount)
+{
+    m_sampleCount = std::max(1, sampleCount);
+}
+
+inline void BenchmarkRunner::SetWarmupCount(int warmupCount)
+{
+    m_warmupCount = std::max(0, warmupCount);
+}
+
+inline void BenchmarkRunner::SetFilter(const std::string &filter)
+{
+    m_filter = filter;
+}
+
+inline void BenchmarkRunner::SetLabel(const std::string &label)
+{
+    m_label = label;
+}
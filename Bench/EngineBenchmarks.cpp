@@ -0,0 +1,317 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "EngineBenchmarks.h"
+
+#define BENCH_SPRITE_SHEET "../Assets/Atlas/UI.json"
+#define BENCH_FONT "../Assets/Font/FutilePro.dat"
+
+BenchScene::BenchScene(InputManager *inputManager) :
+    Scene(nullptr, inputManager)
+{
+}
+
+/// @brief Corps statique carr utilis par les benchmarks des requtes.
+class BenchBody : public GameBody
+{
+public:
+    BenchBody(Scene *scene, b2Vec2 position) :
+        GameBody(scene, 0), m_position(position)
+    {
+        SetContactEvents(CONTACT_NONE);
+    }
+
+    virtual void Start() override
+    {
+        b2BodyDef bodyDef;
+        bodyDef.type = b2_staticBody;
+        bodyDef.position = m_position;
+        CreateBody(&bodyDef);
+
+        b2PolygonShape box;
+        box.SetAsBox(0.5f, 0.5f);
+
+        b2FixtureDef fixtureDef;
+        fixtureDef.shape = &box;
+        CreateFixture(&fixtureDef);
+    }
+
+private:
+    b2Vec2 m_position;
+};
+
+/// @brief Texte dont la texture peut tre recalcule sans changer la chane.
+class BenchText : public Text
+{
+public:
+    BenchText(TTF_Font *font, const std::string &str) :
+        Text(g_renderer, font, str, SDL_Color{ 255, 255, 255, 255 })
+    {}
+
+    void Refresh()
+    {
+        RefreshTexture();
+    }
+};
+
+static float RandomFloat(float minValue, float maxValue)
+{
+    return minValue + (maxValue - minValue) * (float)rand() / (float)RAND_MAX;
+}
+
+void RunObjectBenchmarks(BenchmarkRunner &runner, InputManager *inputManager)
+{
+    const int objectCounts[] = { 100, 1000, 10000 };
+    for (int objectCount : objectCounts)
+    {
+        BenchScene scene(inputManager);
+        ObjectManager &objectManager = scene.GetObjectManager();
+        std::vector<GameObject *> objects;
+        objects.reserve(objectCount);
+
+        auto spawnObjects = [&]()
+        {
+            for (int i = 0; i < objectCount; i++)
+            {
+                objects.push_back(new GameObject(&scene, rand() % 8));
+            }
+            objectManager.ProcessObjects();
+        };
+        auto deleteObjects = [&]()
+        {
+            for (GameObject *gameObject : objects)
+            {
+                gameObject->Delete();
+            }
+            objects.clear();
+            objectManager.ProcessObjects();
+        };
+
+        const std::string suffix = "/" + std::to_string(objectCount);
+        runner.Run(
+            "ObjectManager::ProcessObjects/Spawn" + suffix,
+            spawnObjects, deleteObjects, objectCount
+        );
+        runner.Run(
+            "ObjectManager::ProcessObjects/Delete" + suffix,
+            deleteObjects, spawnObjects, objectCount
+        );
+        deleteObjects();
+
+        // Tri des objets visibles selon leurs layers
+        spawnObjects();
+        for (GameObject *gameObject : objects)
+        {
+            gameObject->SetVisible(true);
+        }
+        runner.Run(
+            "ObjectManager::ProcessVisibleObjects" + suffix,
+            [&]() { objectManager.ProcessVisibleObjects(); },
+            nullptr, objectCount
+        );
+    }
+}
+
+void RunQueryBenchmarks(BenchmarkRunner &runner, InputManager *inputManager)
+{
+    const int bodyCount = 2000;
+    const int queryCount = 1000;
+    const float worldSize = 200.f;
+
+    BenchScene scene(inputManager);
+    for (int i = 0; i < bodyCount; i++)
+    {
+        b2Vec2 position(RandomFloat(0.f, worldSize), RandomFloat(0.f, worldSize));
+        new BenchBody(&scene, position);
+    }
+    scene.GetObjectManager().ProcessObjects();
+
+    // Les requtes sont les mmes pour chaque chantillon
+    std::vector<b2Vec2> points;
+    for (int i = 0; i < 2 * queryCount; i++)
+    {
+        points.push_back(b2Vec2(RandomFloat(0.f, worldSize), RandomFloat(0.f, worldSize)));
+    }
+
+    QueryFilter filter;
+    std::vector<OverlapResult> overlapResults;
+    std::vector<RayHit> rayHits;
+
+    runner.Run("Scene::OverlapCircle", [&]()
+    {
+        for (int i = 0; i < queryCount; i++)
+        {
+            overlapResults.clear();
+            scene.OverlapCircle(points[i], 3.f, filter, overlapResults);
+        }
+    }, nullptr, queryCount);
+
+    runner.Run("Scene::OverlapBox", [&]()
+    {
+        for (int i = 0; i < queryCount; i++)
+        {
+            overlapResults.clear();
+            scene.OverlapBox(points[i], b2Vec2(3.f, 2.f), 30.f, filter, overlapResults);
+        }
+    }, nullptr, queryCount);
+
+    runner.Run("Scene::RayCastFirst", [&]()
+    {
+        for (int i = 0; i < queryCount; i++)
+        {
+            scene.RayCastFirst(points[2 * i], points[2 * i + 1], filter);
+        }
+    }, nullptr, queryCount);
+
+    runner.Run("Scene::RayCast", [&]()
+    {
+        for (int i = 0; i < queryCount; i++)
+        {
+            rayHits.clear();
+            scene.RayCast(points[2 * i], points[2 * i + 1], filter, rayHits);
+        }
+    }, nullptr, queryCount);
+}
+
+void RunAssetBenchmarks(BenchmarkRunner &runner, InputManager *inputManager)
+{
+    runner.Run("SpriteSheet::SpriteSheet", [&]()
+    {
+        SpriteSheet spriteSheet(g_renderer, BENCH_SPRITE_SHEET);
+    });
+
+    const size_t byteCount = 4 * 1024 * 1024;
+    std::vector<Uint8> memory(byteCount);
+    for (size_t i = 0; i < byteCount; i++)
+    {
+        memory[i] = (Uint8)rand();
+    }
+    runner.Run("AssetManager::RetriveMem", [&]()
+    {
+        AssetManager::RetriveMem(memory.data(), byteCount);
+    }, nullptr, 1, byteCount);
+}
+
+void RunRenderingBenchmarks(BenchmarkRunner &runner, InputManager *inputManager)
+{
+    BenchScene scene(inputManager);
+    AssetManager *assets = scene.GetAssetManager();
+    assets->AddFont(0, BENCH_FONT, 32);
+
+    BenchText text(assets->GetFont(0), "Benchmark 0123456789");
+    runner.Run("Text::RefreshTexture", [&]() { text.Refresh(); });
+
+    // Particules
+    const int particleCount = 2000;
+    const float dt = 1.f / 60.f;
+    SpriteSheet spriteSheet(g_renderer, BENCH_SPRITE_SHEET);
+    SpriteGroup *spriteGroup = spriteSheet.GetGroup(0);
+    AssertNew(spriteGroup);
+
+    Camera *camera = new Camera(&scene);
+    scene.SetActiveCamera(camera);
+    scene.GetObjectManager().ProcessObjects();
+
+    std::vector<Particle *> particles;
+    for (int i = 0; i < particleCount; i++)
+    {
+        b2Vec2 position(RandomFloat(0.f, 24.f), RandomFloat(0.f, 14.f));
+        Particle *particle = new Particle(
+            scene.GetAnimationSystem(), spriteGroup, position, 32.f
+        );
+        particle->SetLifetime(1.e6f);
+        particle->SetVelocity(b2Vec2(RandomFloat(-1.f, 1.f), RandomFloat(-1.f, 1.f)));
+        particle->SetGravity(b2Vec2(0.f, -10.f));
+        particle->SetDamping(0.5f);
+        particle->CreateAlphaAnimation(1.f, 0.f);
+        particles.push_back(particle);
+    }
+
+    runner.Run("Particle::Update", [&]()
+    {
+        for (Particle *particle : particles)
+        {
+            particle->Update(dt);
+        }
+    }, nullptr, particleCount);
+
+    // Chaque particule possde une SpriteAnim et une LerpAnim
+    AnimationSystem *animations = scene.GetAnimationSystem();
+    runner.Run("AnimationSystem::Update", [&]()
+    {
+        animations->Update(AnimClock::SCENE, dt);
+        animations->DispatchEvents();
+    }, nullptr, animations->GetAnimationCount());
+
+    // Courbes d'acclration : appel indirect par valeur contre valuation groupe
+    const int easingCount = 4096;
+    std::vector<float> easingIn(easingCount), easingOut(easingCount);
+    for (int i = 0; i < easingCount; i++)
+    {
+        easingIn[i] = (float)i / (float)(easingCount - 1);
+    }
+
+    EasingFct volatile easingPtr = EasingFct_InOut;
+    runner.Run("EasingFct_InOut/PerValue", [&]()
+    {
+        EasingFct easing = easingPtr;
+        for (int i = 0; i < easingCount; i++)
+        {
+            easingOut[i] = easing(easingIn[i]);
+        }
+    }, nullptr, easingCount);
+
+    runner.Run("EasingFct_Evaluate/InOut", [&]()
+    {
+        EasingFct_Evaluate(EaseInOut(), easingIn.data(), easingOut.data(), easingCount);
+    }, nullptr, easingCount);
+
+    runner.Run("Particle::Render", [&]()
+    {
+        for (Particle *particle : particles)
+        {
+            particle->Render(g_renderer, camera);
+        }
+    }, nullptr, particleCount);
+
+    for (Particle *particle : particles)
+    {
+        delete particle;
+    }
+}
+
+void RunUIBenchmarks(BenchmarkRunner &runner, InputManager *inputManager)
+{
+    const int depths[] = { 4, 16, 64 };
+    const int queryCount = 1000;
+
+    for (int depth : depths)
+    {
+        BenchScene scene(inputManager);
+
+        UIObject *leaf = nullptr;
+        for (int i = 0; i < depth; i++)
+        {
+            UIObject *uiObject = new UIObject(&scene);
+            if (leaf) uiObject->SetParent(leaf);
+            uiObject->SetLocalRect(UIRect(
+                b2Vec2(0.1f, 0.1f), b2Vec2(0.9f, 0.9f),
+                b2Vec2(1.f, 1.f), b2Vec2(-1.f, -1.f)
+            ));
+            leaf = uiObject;
+        }
+        scene.GetObjectManager().ProcessObjects();
+
+        volatile float sink = 0.f;
+        runner.Run("UIObject::GetCanvasRect/Depth" + std::to_string(depth), [&]()
+        {
+            for (int i = 0; i < queryCount; i++)
+            {
+                sink = sink + leaf->GetCanvasRect().w;
+            }
+        }, nullptr, queryCount);
+    }
+}
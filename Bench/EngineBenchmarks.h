@@ -0,0 +1,29 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Benchmark.h"
+
+/// @brief Scne de benchmark donnant accs  son gestionnaire d'objets.
+class BenchScene : public Scene
+{
+public:
+    BenchScene(InputManager *inputManager);
+
+    ObjectManager &GetObjectManager();
+};
+
+inline ObjectManager &BenchScene::GetObjectManager()
+{
+    return m_objectManager;
+}
+
+void RunObjectBenchmarks(BenchmarkRunner &runner, InputManager *inputManager);
+void RunQueryBenchmarks(BenchmarkRunner &runner, InputManager *inputManager);
+void RunAssetBenchmarks(BenchmarkRunner &runner, InputManager *inputManager);
+void RunRenderingBenchmarks(BenchmarkRunner &runner, InputManager *inputManager);
+void RunUIBenchmarks(BenchmarkRunner &runner, InputManager *inputManager);
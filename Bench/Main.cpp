@@ -0,0 +1,81 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "Benchmark.h"
+#include "EngineBenchmarks.h"
+
+int main(int argc, char *argv[])
+{
+    BenchmarkRunner runner;
+    std::string outPath;
+
+    // Options de la ligne de commande
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string option(argv[i]);
+        const char *value = argv[i + 1];
+
+        if (option == "--out") outPath = value;
+        else if (option == "--samples") runner.SetSampleCount(atoi(value));
+        else if (option == "--warmup") runner.SetWarmupCount(atoi(value));
+        else if (option == "--filter") runner.SetFilter(value);
+        else if (option == "--label") runner.SetLabel(value);
+        else
+        {
+            std::cout << "ERROR - Unknown option " << option << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Pas de fentre : pilotes SDL factices et rendu logiciel
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+
+    int exitStatus = Game_Init(SDL_INIT_VIDEO, IMG_INIT_PNG, 0, 16);
+    if (exitStatus == EXIT_FAILURE)
+    {
+        assert(false);
+        abort();
+    }
+
+    srand(0);
+    Profiler::SetEnabled(false);
+
+    g_window = SDL_CreateWindow(
+        "Bench", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+        1280, 720, SDL_WINDOW_HIDDEN
+    );
+    if (!g_window)
+    {
+        printf("ERROR - Create window %s\n", SDL_GetError());
+        assert(false); abort();
+    }
+
+    g_renderer = SDL_CreateRenderer(g_window, -1, SDL_RENDERER_SOFTWARE);
+    if (!g_renderer)
+    {
+        printf("ERROR - Create renderer %s\n", SDL_GetError());
+        assert(false); abort();
+    }
+    SDL_SetRenderDrawBlendMode(g_renderer, SDL_BLENDMODE_BLEND);
+
+    InputManager *inputManager = new InputManager();
+
+    RunObjectBenchmarks(runner, inputManager);
+    RunQueryBenchmarks(runner, inputManager);
+    RunAssetBenchmarks(runner, inputManager);
+    RunRenderingBenchmarks(runner, inputManager);
+    RunUIBenchmarks(runner, inputManager);
+
+    exitStatus = runner.WriteJSON(outPath);
+
+    delete inputManager; inputManager = nullptr;
+    SDL_DestroyRenderer(g_renderer); g_renderer = nullptr;
+    SDL_DestroyWindow(g_window); g_window = nullptr;
+    Game_Quit();
+
+    return exitStatus;
+}
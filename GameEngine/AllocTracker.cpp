@@ -0,0 +1,305 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "AllocTracker.h"
+
+#include <new>
+#ifdef _WIN32
+#  include <malloc.h>
+#endif
+
+std::atomic<Uint64> AllocTracker::s_allocCount(0);
+std::atomic<Uint64> AllocTracker::s_allocBytes(0);
+Uint64 AllocTracker::s_frameBeginCount = 0;
+Uint64 AllocTracker::s_frameBeginBytes = 0;
+Uint64 AllocTracker::s_frameCount = 0;
+Uint64 AllocTracker::s_frameBytes = 0;
+std::array<AllocTracker::Zone, ALLOC_TRACKER_ZONE_COUNT> AllocTracker::s_zones;
+
+const AllocZoneKey AllocTracker::s_noZone("(no zone)");
+thread_local const AllocZoneKey *AllocTracker::t_zone = &AllocTracker::s_noZone;
+thread_local Uint64 AllocTracker::t_allocCount = 0;
+
+AllocZoneKey::AllocZoneKey(const char *name) :
+    name(name), hash(14695981039346656037ULL)
+{
+    // FNV-1a sur le contenu du nom, la valeur 0 marque une entre libre
+    for (const char *c = name; *c != '\0'; c++)
+    {
+        hash = (hash ^ (unsigned char)*c) * 1099511628211ULL;
+    }
+    if (hash == 0) hash = 1;
+}
+
+void AllocTracker::OnAllocate(size_t size)
+{
+    s_allocCount.fetch_add(1, std::memory_order_relaxed);
+    s_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    t_allocCount++;
+
+    Zone *zone = FindZone(*t_zone);
+    if (zone)
+    {
+        zone->count.fetch_add(1, std::memory_order_relaxed);
+        zone->bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+AllocTracker::Zone *AllocTracker::FindZone(const AllocZoneKey &key)
+{
+    // Table  adressage ouvert indice par le hach du nom
+    size_t index = (size_t)(key.hash % ALLOC_TRACKER_ZONE_COUNT);
+    for (int i = 0; i < ALLOC_TRACKER_ZONE_COUNT; i++)
+    {
+        Zone &zone = s_zones[index];
+        const Uint64 zoneHash = zone.hash.load(std::memory_order_acquire);
+        if (zoneHash == key.hash) return &zone;
+
+        if (zoneHash == 0)
+        {
+            Uint64 expected = 0;
+            if (zone.hash.compare_exchange_strong(expected, key.hash))
+            {
+                zone.name.store(key.name, std::memory_order_release);
+                return &zone;
+            }
+            if (expected == key.hash) return &zone;
+        }
+        index = (index + 1) % ALLOC_TRACKER_ZONE_COUNT;
+    }
+
+    // Table pleine : l'allocation n'est compte que globalement
+    return nullptr;
+}
+
+void AllocTracker::NewFrame()
+{
+    const Uint64 allocCount = s_allocCount.load(std::memory_order_relaxed);
+    const Uint64 allocBytes = s_allocBytes.load(std::memory_order_relaxed);
+
+    s_frameCount = allocCount - s_frameBeginCount;
+    s_frameBytes = allocBytes - s_frameBeginBytes;
+    s_frameBeginCount = allocCount;
+    s_frameBeginBytes = allocBytes;
+}
+
+void AllocTracker::GetTopZones(std::vector<AllocZoneStats> &result, int maxCount)
+{
+    result.clear();
+    for (Zone &zone : s_zones)
+    {
+        // Le nom est publi juste aprs la rservation de l'entre
+        const char *name = zone.name.load(std::memory_order_acquire);
+        if (name == nullptr) continue;
+
+        result.push_back(AllocZoneStats{
+            name,
+            zone.count.load(std::memory_order_relaxed),
+            zone.bytes.load(std::memory_order_relaxed)
+        });
+    }
+
+    std::sort(result.begin(), result.end(),
+        [](const AllocZoneStats &a, const AllocZoneStats &b)
+        {
+            return a.count > b.count;
+        }
+    );
+    if ((int)result.size() > maxCount)
+    {
+        result.resize(maxCount);
+    }
+}
+
+void AllocTracker::PrintReport(int maxCount)
+{
+    if (IsEnabled() == false)
+    {
+        std::cout << "Allocation tracking is disabled (ALLOC_TRACKING_ENABLED)" << std::endl;
+        return;
+    }
+
+    std::vector<AllocZoneStats> zones;
+    GetTopZones(zones, maxCount);
+
+    std::cout << "Allocations: " << s_allocCount.load() << " ("
+        << s_allocBytes.load() / 1024 << " KB), last frame: "
+        << s_frameCount << " (" << s_frameBytes << " B)" << std::endl;
+    for (const AllocZoneStats &zone : zones)
+    {
+        std::cout << "    " << std::setw(10) << zone.count << "  "
+            << std::setw(10) << zone.bytes / 1024 << " KB  " << zone.name << std::endl;
+    }
+}
+
+AllocBudgetScope::AllocBudgetScope(const char *name, int maxCount) :
+    m_name(name), m_maxCount(maxCount), m_beginCount(AllocTracker::GetThreadAllocCount())
+{
+}
+
+AllocBudgetScope::~AllocBudgetScope()
+{
+    if (m_maxCount < 0) return;
+
+    const Uint64 allocCount = AllocTracker::GetThreadAllocCount() - m_beginCount;
+    if (allocCount > (Uint64)m_maxCount)
+    {
+        std::cout << "ERROR - Allocation budget exceeded in " << m_name << ": "
+            << allocCount << " > " << m_maxCount << std::endl;
+        assert(false);
+    }
+}
+
+#ifdef ALLOC_TRACKING_ENABLED
+
+void *operator new(size_t size)
+{
+    AllocTracker::OnAllocate(size);
+    void *memory = malloc(size ? size : 1);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new[](size_t size)
+{
+    AllocTracker::OnAllocate(size);
+    void *memory = malloc(size ? size : 1);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    AllocTracker::OnAllocate(size);
+    return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    AllocTracker::OnAllocate(size);
+    return malloc(size ? size : 1);
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+    free(memory);
+}
+
+#ifdef __cpp_aligned_new
+
+// Versions alignes (types aligns sur plus de __STDCPP_DEFAULT_NEW_ALIGNMENT__).
+// Elles doivent aussi tre remplaces pour que ces allocations soient comptes.
+// Sous Windows, la mmoire aligne est libre par _aligned_free().
+
+static void *AlignedMalloc(size_t size, std::align_val_t alignment)
+{
+    size_t align = (size_t)alignment;
+    if (align < sizeof(void *)) align = sizeof(void *);
+    size = size ? size : 1;
+#ifdef _WIN32
+    return _aligned_malloc(size, align);
+#else
+    void *memory = nullptr;
+    if (posix_memalign(&memory, align, size) != 0) return nullptr;
+    return memory;
+#endif
+}
+
+static void AlignedFree(void *memory)
+{
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+void *operator new(size_t size, std::align_val_t alignment)
+{
+    AllocTracker::OnAllocate(size);
+    void *memory = AlignedMalloc(size, alignment);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new[](size_t size, std::align_val_t alignment)
+{
+    AllocTracker::OnAllocate(size);
+    void *memory = AlignedMalloc(size, alignment);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    AllocTracker::OnAllocate(size);
+    return AlignedMalloc(size, alignment);
+}
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    AllocTracker::OnAllocate(size);
+    return AlignedMalloc(size, alignment);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept
+{
+    AlignedFree(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept
+{
+    AlignedFree(memory);
+}
+
+void operator delete(void *memory, size_t, std::align_val_t) noexcept
+{
+    AlignedFree(memory);
+}
+
+void operator delete[](void *memory, size_t, std::align_val_t) noexcept
+{
+    AlignedFree(memory);
+}
+
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    AlignedFree(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    AlignedFree(memory);
+}
+
+#endif // __cpp_aligned_new
+
+#endif
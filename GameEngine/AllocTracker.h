@@ -0,0 +1,159 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#include <atomic>
+
+// Dcommenter pour remplacer les oprateurs new/delete globaux
+// et compter les allocations par frame et par zone du profileur
+//#define ALLOC_TRACKING_ENABLED
+
+#define ALLOC_TRACKER_ZONE_COUNT 256
+
+#define ALLOC_CONCAT_INNER(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_INNER(a, b)
+
+#ifdef ALLOC_TRACKING_ENABLED
+/// @brief Vrifie  la sortie du bloc courant que le thread appelant
+/// n'a pas effectu plus de maxCount allocations.
+/// @param name nom du bloc (chane littrale).
+/// @param maxCount nombre maximal d'allocations, ngatif pour ne rien vrifier.
+#  define ALLOC_BUDGET_SCOPE(name, maxCount) \
+    AllocBudgetScope ALLOC_CONCAT(allocBudget, __LINE__)(name, maxCount)
+#else
+#  define ALLOC_BUDGET_SCOPE(name, maxCount)
+#endif
+
+/// @brief Identifiant d'une zone du profileur pour le comptage des allocations.
+/// Le nom est hach une seule fois par site d'appel (variable statique locale),
+/// si bien que deux zones de mme nom partagent les mmes compteurs
+/// mme si leurs chanes littrales ont des adresses diffrentes.
+struct AllocZoneKey
+{
+    AllocZoneKey(const char *name);
+
+    const char *name;
+    Uint64 hash;
+};
+
+/// @brief Allocations attribues  une zone du profileur.
+struct AllocZoneStats
+{
+    const char *name;
+    Uint64 count;
+    Uint64 bytes;
+};
+
+/// @brief Comptage des allocations dynamiques.
+/// Chaque allocation est attribue  la zone du profileur la plus interne
+/// du thread qui l'effectue. Les compteurs n'allouent pas de mmoire.
+class AllocTracker
+{
+public:
+    static bool IsEnabled();
+
+    /// @brief Enregistre une allocation. Appele par l'oprateur new.
+    static void OnAllocate(size_t size);
+
+    /// @brief Calcule les allocations de la frame coule.
+    /// Appele par Profiler::NewFrame().
+    static void NewFrame();
+
+    static Uint64 GetFrameAllocCount();
+    static Uint64 GetFrameAllocBytes();
+
+    /// @brief Renvoie le nombre d'allocations effectues par le thread appelant.
+    static Uint64 GetThreadAllocCount();
+
+    /// @brief Dfinit la zone courante du thread appelant.
+    /// @param zone la zone, dont la dure de vie doit tre statique.
+    /// @return La zone prcdente,  restaurer avec LeaveZone().
+    static const AllocZoneKey *EnterZone(const AllocZoneKey *zone);
+    static void LeaveZone(const AllocZoneKey *previousZone);
+
+    /// @brief Renvoie les zones qui ont effectu le plus d'allocations.
+    /// @param result les zones, tries par nombre d'allocations dcroissant.
+    /// @param maxCount le nombre maximal de zones.
+    static void GetTopZones(std::vector<AllocZoneStats> &result, int maxCount);
+    static void PrintReport(int maxCount);
+
+private:
+    struct Zone
+    {
+        std::atomic<Uint64> hash;
+        std::atomic<const char *> name;
+        std::atomic<Uint64> count;
+        std::atomic<Uint64> bytes;
+    };
+
+    static Zone *FindZone(const AllocZoneKey &key);
+
+    static std::atomic<Uint64> s_allocCount;
+    static std::atomic<Uint64> s_allocBytes;
+    static Uint64 s_frameBeginCount;
+    static Uint64 s_frameBeginBytes;
+    static Uint64 s_frameCount;
+    static Uint64 s_frameBytes;
+    static std::array<Zone, ALLOC_TRACKER_ZONE_COUNT> s_zones;
+
+    static const AllocZoneKey s_noZone;
+    static thread_local const AllocZoneKey *t_zone;
+    static thread_local Uint64 t_allocCount;
+};
+
+/// @brief Budget d'allocations d'un bloc, vrifi par une assertion.
+class AllocBudgetScope
+{
+public:
+    AllocBudgetScope(const char *name, int maxCount);
+    AllocBudgetScope(AllocBudgetScope const&) = delete;
+    AllocBudgetScope& operator=(AllocBudgetScope const&) = delete;
+    ~AllocBudgetScope();
+
+private:
+    const char *m_name;
+    int m_maxCount;
+    Uint64 m_beginCount;
+};
+
+inline bool AllocTracker::IsEnabled()
+{
+#ifdef ALLOC_TRACKING_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline Uint64 AllocTracker::GetFrameAllocCount()
+{
+    return s_frameCount;
+}
+
+inline Uint64 AllocTracker::GetFrameAllocBytes()
+{
+    return s_frameBytes;
+}
+
+inline Uint64 AllocTracker::GetThreadAllocCount()
+{
+    return t_allocCount;
+}
+
+inline const AllocZoneKey *AllocTracker::EnterZone(const AllocZoneKey *zone)
+{
+    const AllocZoneKey *previousZone = t_zone;
+    t_zone = zone;
+    return previousZone;
+}
+
+inline void AllocTracker::LeaveZone(const AllocZoneKey *previousZone)
+{
+    t_zone = previousZone;
+}
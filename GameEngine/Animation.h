@@ -8,22 +8,10 @@
 
 #include "Settings.h"
 #include "EasingFct.h"
+#include "AnimationSystem.h"
 
 class Animation;
 
-enum class AnimFlag : uint32_t
-{
-    /// @brief Met l'animation en pause.
-    PAUSED = 1 << 0,
-    /// @brief Joue l'animation dans le sens inverse.
-    REVERSED = 1 << 1,
-    /// @brief Joue l'animation en avant puis en arrire.
-    ALTERNATE = 1 << 2,
-    /// @brief Arrte automatiquement l'animation  la fin.
-    STOP_AT_END = 1 << 3,
-    STOPPED = 1 << 4
-};
-
 class AnimationListener
 {
 public:
@@ -35,20 +23,29 @@ public:
     virtual void OnFrameChanged(Animation *which, const std::string &name, int frameID) {}
 };
 
+/// @brief Animation d'une scne.
+/// Son tat de lecture est stock dans l'AnimationSystem de la scne,
+/// qui la fait avancer avec son horloge.
 class Animation
 {
 public:
-    Animation(const std::string &name);
+    Animation(AnimationSystem *system, const std::string &name);
     Animation(Animation const&) = delete;
     Animation& operator=(Animation const&) = delete;
     virtual ~Animation();
 
-    virtual void SetCycleTime(float cycleTime);
+    void SetCycleTime(float cycleTime);
     void SetCycleCount(int cycleCount);
     void SetDelay(float delay);
     void SetSpeed(float speed);
     void SetPhase(float phase);
     void SetEasing(EasingFct easing);
+    EasingFct GetEasing() const;
+
+    /// @brief Dfinit l'horloge qui fait avancer l'animation.
+    /// Par dfaut, l'animation avance avec le temps de la scne.
+    void SetClock(AnimClock clock);
+    AnimClock GetClock() const;
 
     void AddListener(AnimationListener *listener);
     void RemoveListener(AnimationListener *listener);
@@ -56,6 +53,11 @@ public:
     const std::string &GetName() const;
     float GetRawProgression() const;
     float GetProgression() const;
+
+    /// @brief Renvoie la position dans le cycle (phase, sens et alternance
+    /// compris) avant l'application de la courbe d'acclration.
+    float GetCycleRatio() const;
+
     float GetCycleTime() const;
     float GetTotalTime() const;
 
@@ -65,87 +67,63 @@ public:
     bool IsDelayed() const;
     bool IsPlaying() const;
 
-    virtual void Play();
-    virtual void Resume();
-    virtual void Stop();
-    virtual void Update(float dt);
+    void Play();
+    void Resume();
+    void Stop();
 
 protected:
+    friend class AnimationSystem;
 
-    std::string m_name;
-
-    /// @brief Courbe d'acclration de l'animation.
-    EasingFct m_easing;
-
-    /// @brief Phase de l'animation.
-    float m_phase;
-
-    /// @brief Le coefficient multiplicateur de la vitesse de lecture.
-    float m_speed;
+    Animation(AnimationSystem *system, const std::string &name, SpriteGroup *spriteGroup);
 
-    /// @brief La dure d'un cycle.
-    float m_cycleTime;
-
-    /// @brief Dlai avant le dbut de l'animation.
-    float m_delay;
-
-    /// @brief Accumulateur.
-    float m_accu;
-
-    /// @brief Accumulateur pour le dlai.
-    float m_delayAccu;
-
-    /// @brief Les flags de l'animation.
-    /// Les valeurs possibles des flags sont donnes dans l'numration AnimFlags.
-    AnimFlag m_flags;
+    std::string m_name;
 
-    /// @brief Nombre de cycles de l'animation.
-    /// L'animation tourne en boucle si ce membre vaut -1.
-    int m_cycleCount;
+    /// @brief Systme stockant l'tat de lecture de l'animation.
+    AnimationSystem *m_system;
 
-    /// @brief Indice du cycle courant. 
-    int m_cycleIdx;
+    /// @brief Indice de l'animation dans les tableaux du systme.
+    int m_index;
 
     std::set<AnimationListener *> m_listeners;
 };
 
-constexpr enum AnimFlag operator |(const enum AnimFlag selfValue, const enum AnimFlag inValue)
+inline void Animation::SetCycleTime(float cycleTime)
 {
-    return (enum AnimFlag)(uint32_t(selfValue) | uint32_t(inValue));
+    m_system->m_cycleTimes[m_index] = cycleTime;
 }
 
-constexpr enum AnimFlag operator &(const enum AnimFlag selfValue, const enum AnimFlag inValue)
+inline void Animation::SetDelay(float delay)
 {
-    return (enum AnimFlag)(uint32_t(selfValue) & uint32_t(inValue));
+    m_system->m_delays[m_index] = delay;
 }
-
-constexpr enum AnimFlag operator ~(const enum AnimFlag selfValue)
+inline void Animation::SetSpeed(float speed)
 {
-    return (enum AnimFlag)(~uint32_t(selfValue));
+    m_system->m_speeds[m_index] = speed;
 }
 
-inline void Animation::SetCycleTime(float cycleTime)
+inline void Animation::SetPhase(float phase)
 {
-    m_cycleTime = cycleTime;
+    m_system->m_phases[m_index] = phase;
 }
 
-inline void Animation::SetDelay(float delay)
+inline void Animation::SetEasing(EasingFct easing)
 {
-    m_delay = delay;
+    m_system->m_easings[m_index] = easing;
 }
-inline void Animation::SetSpeed(float speed)
+
+inline EasingFct Animation::GetEasing() const
 {
-    m_speed = speed;
+    return m_system->m_easings[m_index];
 }
 
-inline void Animation::SetPhase(float phase)
+inline void Animation::SetClock(AnimClock clock)
 {
-    m_phase = phase;
+    m_system->m_clocks[m_index] = clock;
 }
 
-inline void Animation::SetEasing(EasingFct easing)
+inline AnimClock Animation::GetClock() const
 {
-    m_easing = easing;
+    return m_system->m_clocks[m_index];
 }
 
 inline void Animation::AddListener(AnimationListener *listener)
@@ -160,31 +138,44 @@ inline void Animation::RemoveListener(AnimationListener *listener)
 
 inline void Animation::AddFlags(AnimFlag flags)
 {
-    m_flags = m_flags | flags;
+    AnimFlag &animFlags = m_system->m_flags[m_index];
+    animFlags = animFlags | flags;
 }
 
 inline void Animation::SubFlags(AnimFlag flags)
 {
-    m_flags = m_flags & ~flags;
+    AnimFlag &animFlags = m_system->m_flags[m_index];
+    animFlags = animFlags & ~flags;
 }
+
 inline float Animation::GetRawProgression() const
 {
-    return m_accu / m_cycleTime;
+    return m_system->m_accus[m_index] / m_system->m_cycleTimes[m_index];
+}
+
+inline float Animation::GetProgression() const
+{
+    return m_system->GetProgression(m_index);
+}
+
+inline float Animation::GetCycleRatio() const
+{
+    return m_system->GetCycleRatio(m_index);
 }
 
 inline bool Animation::IsStopped() const
 {
-    return uint32_t(m_flags & AnimFlag::STOPPED) != 0;
+    return uint32_t(m_system->m_flags[m_index] & AnimFlag::STOPPED) != 0;
 }
 
 inline bool Animation::IsDelayed() const
 {
-    return m_delayAccu > 0.f;
+    return m_system->m_delayAccus[m_index] > 0.f;
 }
 
 inline bool Animation::IsPlaying() const
 {
-    return !(uint32_t(m_flags & (AnimFlag::STOPPED | AnimFlag::PAUSED)));
+    return !(uint32_t(m_system->m_flags[m_index] & (AnimFlag::STOPPED | AnimFlag::PAUSED)));
 }
 
 inline const std::string &Animation::GetName() const
@@ -194,10 +185,12 @@ inline const std::string &Animation::GetName() const
 
 inline float Animation::GetCycleTime() const
 {
-    return m_cycleTime;
+    return m_system->m_cycleTimes[m_index];
 }
 
 inline float Animation::GetTotalTime() const
 {
-    return m_cycleCount >= 0 ? m_cycleCount * m_cycleTime : m_cycleTime;
+    const int cycleCount = m_system->m_cycleCounts[m_index];
+    const float cycleTime = m_system->m_cycleTimes[m_index];
+    return cycleCount >= 0 ? cycleCount * cycleTime : cycleTime;
 }
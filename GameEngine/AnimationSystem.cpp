@@ -0,0 +1,313 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "AnimationSystem.h"
+#include "Animation.h"
+#include "SpriteSheet.h"
+
+#define ANIM_EPSILON 0.001f
+
+#define STEP_RUNNING 0x1
+#define STEP_DELAYED 0x2
+
+AnimationSystem::AnimationSystem() :
+    m_animations(), m_accus(), m_delayAccus(), m_delays(), m_speeds(),
+    m_cycleTimes(), m_phases(), m_easings(), m_flags(), m_clocks(),
+    m_cycleCounts(), m_cycleIndices(), m_serials(), m_spriteGroups(), m_frameIDs(),
+    m_stepStates(), m_events()
+{
+}
+
+AnimationSystem::~AnimationSystem()
+{
+    // Les animations encore vivantes ne doivent plus se retirer du systme
+    for (Animation *animation : m_animations)
+    {
+        animation->m_system = nullptr;
+        animation->m_index = -1;
+    }
+}
+
+int AnimationSystem::AddAnimation(Animation *animation, SpriteGroup *spriteGroup)
+{
+    const int index = (int)m_animations.size();
+
+    m_animations.push_back(animation);
+    m_accus.push_back(0.f);
+    m_delayAccus.push_back(0.f);
+    m_delays.push_back(0.f);
+    m_speeds.push_back(1.f);
+    m_cycleTimes.push_back(1.f);
+    m_phases.push_back(0.f);
+    m_easings.push_back(EasingFct_Linear);
+    m_flags.push_back(AnimFlag::STOP_AT_END | AnimFlag::STOPPED);
+    m_clocks.push_back(AnimClock::SCENE);
+    m_cycleCounts.push_back(-1);
+    m_cycleIndices.push_back(0);
+    m_serials.push_back(0);
+    m_spriteGroups.push_back(spriteGroup);
+    m_frameIDs.push_back(0);
+    m_stepStates.push_back(0);
+
+    return index;
+}
+
+void AnimationSystem::RemoveAnimation(Animation *animation)
+{
+    const int index = animation->m_index;
+    assert(0 <= index && index < (int)m_animations.size());
+    assert(m_animations[index] == animation);
+
+    // Remplace l'animation par la dernire du tableau
+    const int last = (int)m_animations.size() - 1;
+    if (index != last)
+    {
+        m_animations[index] = m_animations[last];
+        m_accus[index] = m_accus[last];
+        m_delayAccus[index] = m_delayAccus[last];
+        m_delays[index] = m_delays[last];
+        m_speeds[index] = m_speeds[last];
+        m_cycleTimes[index] = m_cycleTimes[last];
+        m_phases[index] = m_phases[last];
+        m_easings[index] = m_easings[last];
+        m_flags[index] = m_flags[last];
+        m_clocks[index] = m_clocks[last];
+        m_cycleCounts[index] = m_cycleCounts[last];
+        m_cycleIndices[index] = m_cycleIndices[last];
+        m_serials[index] = m_serials[last];
+        m_spriteGroups[index] = m_spriteGroups[last];
+        m_frameIDs[index] = m_frameIDs[last];
+        m_stepStates[index] = m_stepStates[last];
+        m_animations[index]->m_index = index;
+    }
+
+    m_animations.pop_back();
+    m_accus.pop_back();
+    m_delayAccus.pop_back();
+    m_delays.pop_back();
+    m_speeds.pop_back();
+    m_cycleTimes.pop_back();
+    m_phases.pop_back();
+    m_easings.pop_back();
+    m_flags.pop_back();
+    m_clocks.pop_back();
+    m_cycleCounts.pop_back();
+    m_cycleIndices.pop_back();
+    m_serials.pop_back();
+    m_spriteGroups.pop_back();
+    m_frameIDs.pop_back();
+    m_stepStates.pop_back();
+
+    animation->m_system = nullptr;
+    animation->m_index = -1;
+
+    // Les messages en attente ne concernent plus cette animation
+    for (PendingEvent &pending : m_events)
+    {
+        if (pending.animation == animation)
+        {
+            pending.animation = nullptr;
+        }
+    }
+}
+
+void AnimationSystem::Update(AnimClock clock, float dt)
+{
+    const int count = (int)m_animations.size();
+    const uint32_t inactiveMask = uint32_t(AnimFlag::PAUSED | AnimFlag::STOPPED);
+
+    // Premire passe : avance les accumulateurs, sans branchement
+    // ni appel virtuel pour permettre la vectorisation de la boucle
+    for (int i = 0; i < count; i++)
+    {
+        const bool running =
+            ((uint32_t(m_flags[i]) & inactiveMask) == 0) && (m_clocks[i] == clock);
+        const bool delayed = m_delayAccus[i] > ANIM_EPSILON;
+        const float step = running ? dt : 0.f;
+
+        m_delayAccus[i] -= delayed ? step : 0.f;
+        m_accus[i] += delayed ? 0.f : step * m_speeds[i];
+        m_stepStates[i] = (running ? STEP_RUNNING : 0) | (delayed ? STEP_DELAYED : 0);
+    }
+
+    // Seconde passe : fins de cycle et changements d'image
+    for (int i = 0; i < count; i++)
+    {
+        const uint8_t state = m_stepStates[i];
+        if ((state & STEP_RUNNING) == 0) continue;
+
+        if (state & STEP_DELAYED)
+        {
+            if (m_delayAccus[i] <= ANIM_EPSILON)
+            {
+                PushEvent(EventType::START, i);
+            }
+            continue;
+        }
+
+        const int prevCycleIdx = m_cycleIndices[i];
+        const float cycleTime = m_cycleTimes[i];
+        while (m_accus[i] >= cycleTime - ANIM_EPSILON)
+        {
+            m_accus[i] -= cycleTime;
+            m_cycleIndices[i]++;
+
+            PushEvent(EventType::CYCLE_END, i);
+
+            const int cycleCount = m_cycleCounts[i];
+            if ((cycleCount > 0) && (m_cycleIndices[i] >= cycleCount))
+            {
+                // Fin de l'animation
+                m_accus[i] = cycleTime;
+                m_flags[i] = m_flags[i] | AnimFlag::PAUSED;
+
+                if (uint32_t(m_flags[i] & AnimFlag::STOP_AT_END))
+                {
+                    m_flags[i] = m_flags[i] | AnimFlag::STOPPED;
+                }
+
+                PushEvent(EventType::END, i);
+                break;
+            }
+        }
+
+        SpriteGroup *spriteGroup = m_spriteGroups[i];
+        if (spriteGroup == nullptr) continue;
+        if (uint32_t(m_flags[i] & AnimFlag::STOPPED)) continue;
+
+        // Le groupe peut changer de nombre d'images aprs un rechargement
+        const int frameCount = spriteGroup->GetSpriteCount();
+        if (frameCount < 1) continue;
+
+        // La table des dures des images est partage par le groupe
+        const float time = GetProgression(i) * cycleTime;
+        int frameID = 0;
+        if (cycleTime > 0.f)
+        {
+            frameID = spriteGroup->GetFrameAt((time + ANIM_EPSILON) / cycleTime);
+        }
+
+        const int prevFrameID = std::min(m_frameIDs[i], frameCount - 1);
+        const bool newCycle = prevCycleIdx < m_cycleIndices[i];
+        if (frameID != prevFrameID || newCycle)
+        {
+            m_frameIDs[i] = frameID;
+            PushFrameEvents(i, prevFrameID, frameID, newCycle);
+        }
+    }
+}
+
+void AnimationSystem::PushEvent(EventType type, int index, int frameID)
+{
+    Animation *animation = m_animations[index];
+    if (animation->m_listeners.empty()) return;
+
+    PendingEvent pending;
+    pending.type = type;
+    pending.animation = animation;
+    pending.serial = m_serials[index];
+    pending.frameID = frameID;
+    m_events.push_back(pending);
+}
+
+void AnimationSystem::PushFrameEvents(int index, int prevFrameID, int frameID, bool newCycle)
+{
+    if (m_animations[index]->m_listeners.empty()) return;
+
+    const int frameCount = m_spriteGroups[index]->GetSpriteCount();
+    if (newCycle)
+    {
+        // Termine le cycle prcdent puis repart de la premire image
+        for (int i = prevFrameID + 1; i < frameCount; i++)
+        {
+            PushEvent(EventType::FRAME_CHANGED, index, i);
+        }
+        PushEvent(EventType::FRAME_CHANGED, index, 0);
+        prevFrameID = 0;
+    }
+
+    if (frameID > prevFrameID)
+    {
+        for (int i = prevFrameID + 1; i <= frameID; i++)
+        {
+            PushEvent(EventType::FRAME_CHANGED, index, i);
+        }
+    }
+    else if (frameID < prevFrameID)
+    {
+        // Animation inverse
+        PushEvent(EventType::FRAME_CHANGED, index, frameID);
+    }
+}
+
+void AnimationSystem::DispatchEvents()
+{
+    // Messages : OnAnimationStart(), OnCycleEnd(), OnAnimationEnd(), OnFrameChanged()
+    for (size_t i = 0; i < m_events.size(); i++)
+    {
+        const PendingEvent pending = m_events[i];
+        Animation *animation = pending.animation;
+
+        // L'animation a pu tre dtruite, relance ou arrte par un message prcdent
+        if (animation == nullptr) continue;
+        if (m_serials[animation->m_index] != pending.serial) continue;
+
+        const std::string &name = animation->m_name;
+        for (AnimationListener *listener : animation->m_listeners)
+        {
+            switch (pending.type)
+            {
+            case EventType::START:
+                listener->OnAnimationStart(animation, name);
+                break;
+            case EventType::CYCLE_END:
+                listener->OnCycleEnd(animation, name);
+                break;
+            case EventType::END:
+                listener->OnAnimationEnd(animation, name);
+                break;
+            case EventType::FRAME_CHANGED:
+            default:
+                listener->OnFrameChanged(animation, name, pending.frameID);
+                break;
+            }
+
+            if (m_events[i].animation == nullptr) break;
+            if (m_serials[animation->m_index] != pending.serial) break;
+        }
+    }
+
+    m_events.clear();
+}
+
+float AnimationSystem::GetProgression(int index) const
+{
+    return (m_easings[index])(GetCycleRatio(index));
+}
+
+float AnimationSystem::GetCycleRatio(int index) const
+{
+    float t = m_accus[index] / m_cycleTimes[index];
+
+    // Phase
+    t += m_phases[index];
+    if (t > 1.f)
+        t -= floorf(t);
+
+    // Animation alterne
+    if (uint32_t(m_flags[index] & AnimFlag::ALTERNATE))
+    {
+        t = (t < 0.5f) ? 2.f * t : 2.f - 2.f * t;
+    }
+
+    // Animation inverse
+    if (uint32_t(m_flags[index] & AnimFlag::REVERSED))
+    {
+        t = 1.f - t;
+    }
+
+    return t;
+}
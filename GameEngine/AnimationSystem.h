@@ -0,0 +1,139 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+#include "EasingFct.h"
+
+class Animation;
+class SpriteGroup;
+
+enum class AnimFlag : uint32_t
+{
+    /// @brief Met l'animation en pause.
+    PAUSED = 1 << 0,
+    /// @brief Joue l'animation dans le sens inverse.
+    REVERSED = 1 << 1,
+    /// @brief Joue l'animation en avant puis en arrire.
+    ALTERNATE = 1 << 2,
+    /// @brief Arrte automatiquement l'animation  la fin.
+    STOP_AT_END = 1 << 3,
+    STOPPED = 1 << 4
+};
+
+constexpr enum AnimFlag operator |(const enum AnimFlag selfValue, const enum AnimFlag inValue)
+{
+    return (enum AnimFlag)(uint32_t(selfValue) | uint32_t(inValue));
+}
+
+constexpr enum AnimFlag operator &(const enum AnimFlag selfValue, const enum AnimFlag inValue)
+{
+    return (enum AnimFlag)(uint32_t(selfValue) & uint32_t(inValue));
+}
+
+constexpr enum AnimFlag operator ~(const enum AnimFlag selfValue)
+{
+    return (enum AnimFlag)(~uint32_t(selfValue));
+}
+
+/// @brief Horloge qui fait avancer une animation.
+enum class AnimClock : uint8_t
+{
+    /// @brief Temps de la scne, avant les Update().
+    SCENE,
+    /// @brief Temps de la scne sans son chelle de temps (interface).
+    UNSCALED,
+    /// @brief Pas de temps fixe, avant les FixedUpdate().
+    FIXED
+};
+
+/// @brief Systme mettant  jour toutes les animations d'une scne.
+/// L'tat de lecture des animations est stock en structure de tableaux,
+/// indics de manire dense, et avanc en une seule passe par horloge.
+/// Les changements d'image et les fins d'animation sont placs dans une file
+/// puis transmis aux AnimationListener par DispatchEvents().
+/// Les animations sont ajoutes et retires par leur constructeur et leur destructeur.
+class AnimationSystem
+{
+public:
+    AnimationSystem();
+    AnimationSystem(AnimationSystem const&) = delete;
+    AnimationSystem& operator=(AnimationSystem const&) = delete;
+    virtual ~AnimationSystem();
+
+    /// @brief Avance les animations lues par une horloge.
+    /// Les messages sont mis en file et envoys par DispatchEvents().
+    /// @param clock l'horloge des animations  avancer.
+    /// @param dt le pas de temps de l'horloge.
+    void Update(AnimClock clock, float dt);
+
+    /// @brief Envoie les messages mis en file par Update().
+    /// Messages : OnAnimationStart(), OnCycleEnd(), OnAnimationEnd(), OnFrameChanged()
+    void DispatchEvents();
+
+    int GetAnimationCount() const;
+
+private:
+    friend class Animation;
+    friend class SpriteAnim;
+
+    enum class EventType : uint32_t
+    {
+        START, CYCLE_END, END, FRAME_CHANGED
+    };
+
+    struct PendingEvent
+    {
+        EventType type;
+        Animation *animation;
+
+        /// @brief Numro de lecture de l'animation  la mise en file.
+        uint32_t serial;
+        int frameID;
+    };
+
+    int AddAnimation(Animation *animation, SpriteGroup *spriteGroup);
+    void RemoveAnimation(Animation *animation);
+    void PushEvent(EventType type, int index, int frameID = 0);
+    void PushFrameEvents(int index, int prevFrameID, int frameID, bool newCycle);
+    float GetProgression(int index) const;
+
+    /// @brief Renvoie la position dans le cycle, avant la courbe d'acclration.
+    float GetCycleRatio(int index) const;
+
+    // Animations stockes en structure de tableaux, indices de manire dense
+    std::vector<Animation *> m_animations;
+    std::vector<float> m_accus;
+    std::vector<float> m_delayAccus;
+    std::vector<float> m_delays;
+    std::vector<float> m_speeds;
+    std::vector<float> m_cycleTimes;
+    std::vector<float> m_phases;
+    std::vector<EasingFct> m_easings;
+    std::vector<AnimFlag> m_flags;
+    std::vector<AnimClock> m_clocks;
+    std::vector<int> m_cycleCounts;
+    std::vector<int> m_cycleIndices;
+
+    /// @brief Numro de lecture, incrment par Play() et Stop().
+    /// Les messages d'une lecture interrompue ne sont pas envoys.
+    std::vector<uint32_t> m_serials;
+
+    /// @brief Groupe de sprites des SpriteAnim (nullptr pour les autres animations).
+    std::vector<SpriteGroup *> m_spriteGroups;
+    std::vector<int> m_frameIDs;
+
+    /// @brief Etat de chaque animation calcul par la premire passe d'Update().
+    std::vector<uint8_t> m_stepStates;
+
+    std::vector<PendingEvent> m_events;
+};
+
+inline int AnimationSystem::GetAnimationCount() const
+{
+    return (int)m_animations.size();
+}
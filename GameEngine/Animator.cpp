@@ -7,9 +7,11 @@
 #include "Animator.h"
 #include "Animation.h"
 
-Animator::Animator() :
+Animator::Animator(AnimationSystem *system) :
+    m_system(system), m_clock(AnimClock::SCENE),
     m_spriteAnimMap(), m_listeners(), m_activeAnimation(nullptr)
 {
+    assert(m_system);
 }
 
 Animator::~Animator()
@@ -23,7 +25,8 @@ Animator::~Animator()
 SpriteAnim *Animator::CreateAnimation(const std::string &name, SpriteGroup *spriteGroup)
 {
     assert(spriteGroup);
-    SpriteAnim *anim = new SpriteAnim(name, spriteGroup);
+    SpriteAnim *anim = new SpriteAnim(m_system, name, spriteGroup);
+    anim->SetClock(m_clock);
     for (AnimationListener *listener : m_listeners)
     {
         anim->AddListener(listener);
@@ -38,6 +41,7 @@ int Animator::DeleteAnimation(const std::string &name)
     auto it = m_spriteAnimMap.find(name);
     if (it != m_spriteAnimMap.end())
     {
+        if (it->second == m_activeAnimation) m_activeAnimation = nullptr;
         delete it->second;
         m_spriteAnimMap.erase(it);
         return EXIT_SUCCESS;
@@ -96,12 +100,13 @@ void Animator::StopAnimation()
     m_activeAnimation = nullptr;
 }
 
-void Animator::Update(float dt)
+void Animator::SetClock(AnimClock clock)
 {
-    if (m_activeAnimation)
+    for (auto it = m_spriteAnimMap.begin(); it != m_spriteAnimMap.end(); ++it)
     {
-        m_activeAnimation->Update(dt);
+        it->second->SetClock(clock);
     }
+    m_clock = clock;
 }
 
 void Animator::AddListener(AnimationListener *listener)
@@ -16,7 +16,7 @@
 class Animator
 {
 public:
-    Animator();
+    Animator(AnimationSystem *system);
     Animator(Animator const&) = delete;
     Animator& operator=(Animator const&) = delete;
     virtual ~Animator();
@@ -29,7 +29,9 @@ public:
     int ResumeAnimation(const std::string &name);
     void StopAnimation();
 
-    void Update(float dt);
+    /// @brief Dfinit l'horloge des animations existantes et futures.
+    void SetClock(AnimClock clock);
+
     void AddListener(AnimationListener *listener);
     void RemoveListener(AnimationListener *listener);
 
@@ -40,6 +42,8 @@ public:
     bool IsAnimationDelayed() const;
 
 protected:
+    AnimationSystem *m_system;
+    AnimClock m_clock;
     std::map<std::string, SpriteAnim *> m_spriteAnimMap;
     SpriteAnim *m_activeAnimation;
     std::set<AnimationListener *> m_listeners;
@@ -7,20 +7,40 @@
 #include "AssetManager.h"
 #include "Common.h"
 #include "Utils.h"
+#include "Profiler.h"
+#include "AssetWatcher.h"
+
+bool AssetManager::s_hotReload = false;
 
 AssetManager::AssetManager() :
     m_sheetMap(), m_fontMap(), m_soundMap(), m_musicMap(),
     m_backgrounds(), m_sfxChannels(), 
-    m_sfxIndex(0)
+    m_sfxIndex(0), m_watcher(nullptr), m_reloadMutex(),
+    m_watchedPaths(), m_pendingReloads(), m_pendingCount(0)
 {
     for (int i = 4; i < 8; i++)
     {
         m_sfxChannels.push_back(i);
     }
+
+    if (s_hotReload)
+    {
+        m_watcher = new AssetWatcher(
+            [this](const std::string &path) { OnFileChanged(path); }
+        );
+        AssertNew(m_watcher);
+    }
 }
 
 AssetManager::~AssetManager()
 {
+    // Arrte le thread de surveillance avant de dtruire les feuilles
+    if (m_watcher) delete m_watcher;
+    for (PendingReload &reload : m_pendingReloads)
+    {
+        delete reload.staging;
+    }
+
     for (SDL_Texture *texture : m_backgrounds)
     {
         if (texture) SDL_DestroyTexture(texture);
@@ -49,6 +69,8 @@ AssetManager::~AssetManager()
 
 void AssetManager::AddBackgroundLayer(const std::string &path)
 {
+    PROFILE_SCOPE("AssetManager::LoadBackground");
+
     void *rwopsBuffer = NULL;
     SDL_RWops *rwops = NULL;
     CreateRWops(path, &rwops, &rwopsBuffer);
@@ -79,6 +101,15 @@ void AssetManager::AddSpriteSheet(int sheetID, const std::string &path)
     }
 
     m_sheetMap.insert(std::make_pair(sheetID, new SheetData(path)));
+
+    if (m_watcher)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_reloadMutex);
+            m_watchedPaths.insert(std::make_pair(path, WatchedSheet{ sheetID, path }));
+        }
+        m_watcher->AddFile(path);
+    }
 }
 
 void AssetManager::AddFont(int fontID, const std::string &path, int size)
@@ -139,11 +170,111 @@ SpriteSheet *AssetManager::GetSpriteSheet(int sheetID)
     auto it = m_sheetMap.find(sheetID);
     if (it != m_sheetMap.end())
     {
-        return it->second->GetSpriteSheet();
+        return LoadSheet(it->second);
     }
     return nullptr;
 }
 
+SpriteSheet *AssetManager::LoadSheet(SheetData *sheetData)
+{
+    if (m_watcher == nullptr || sheetData->IsLoaded())
+    {
+        return sheetData->GetSpriteSheet();
+    }
+
+    // Surveille aussi la texture, dont le chemin est connu aprs le chargement
+    SpriteSheet *spriteSheet = sheetData->GetSpriteSheet();
+    WatchTexture(spriteSheet);
+
+    return spriteSheet;
+}
+
+void AssetManager::WatchTexture(SpriteSheet *spriteSheet)
+{
+    const std::string &texturePath = spriteSheet->GetTexturePath();
+    {
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        std::vector<WatchedSheet> watchedSheets;
+        auto range = m_watchedPaths.equal_range(spriteSheet->GetPath());
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            watchedSheets.push_back(it->second);
+        }
+        for (const WatchedSheet &watchedSheet : watchedSheets)
+        {
+            m_watchedPaths.insert(std::make_pair(texturePath, watchedSheet));
+        }
+    }
+    m_watcher->AddFile(texturePath);
+}
+
+void AssetManager::SetHotReloadEnabled(bool enabled)
+{
+    s_hotReload = enabled;
+}
+
+void AssetManager::OnFileChanged(const std::string &path)
+{
+    // Appele sur le thread de surveillance
+    std::vector<WatchedSheet> sheets;
+    {
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        auto range = m_watchedPaths.equal_range(path);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            sheets.push_back(it->second);
+        }
+    }
+
+    for (const WatchedSheet &sheet : sheets)
+    {
+        PROFILE_SCOPE("AssetManager::ReloadSpriteSheet");
+
+        SpriteSheet *staging = SpriteSheet::LoadStaging(sheet.jsonPath);
+        if (staging == nullptr) continue;
+
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        m_pendingReloads.push_back(PendingReload{ sheet.sheetID, staging });
+        m_pendingCount = (int)m_pendingReloads.size();
+    }
+}
+
+int AssetManager::ProcessReloads()
+{
+    if (m_pendingCount == 0) return 0;
+
+    std::vector<PendingReload> reloads;
+    {
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        reloads.swap(m_pendingReloads);
+        m_pendingCount = 0;
+    }
+
+    int reloadCount = 0;
+    for (PendingReload &reload : reloads)
+    {
+        auto it = m_sheetMap.find(reload.sheetID);
+        if (it != m_sheetMap.end() && it->second->IsLoaded())
+        {
+            SpriteSheet *spriteSheet = it->second->GetSpriteSheet();
+            std::string texturePath = spriteSheet->GetTexturePath();
+            if (spriteSheet->SwapContents(*reload.staging) == EXIT_SUCCESS)
+            {
+                std::cout << "INFO - Reload sprite sheet " << spriteSheet->GetPath() << std::endl;
+                reloadCount++;
+
+                // La description peut dsigner une autre texture
+                if (spriteSheet->GetTexturePath() != texturePath)
+                {
+                    WatchTexture(spriteSheet);
+                }
+            }
+        }
+        delete reload.staging;
+    }
+    return reloadCount;
+}
+
 TTF_Font *AssetManager::GetFont(int fontID)
 {
     auto it = m_fontMap.find(fontID);
@@ -154,6 +285,16 @@ TTF_Font *AssetManager::GetFont(int fontID)
     return nullptr;
 }
 
+GlyphStrip *AssetManager::GetGlyphStrip(int fontID)
+{
+    auto it = m_fontMap.find(fontID);
+    if (it != m_fontMap.end())
+    {
+        return it->second->GetGlyphStrip();
+    }
+    return nullptr;
+}
+
 const std::vector<SDL_Texture *> &AssetManager::GetBackgrounds()
 {
     return m_backgrounds;
@@ -364,6 +505,7 @@ Mix_Music *AssetManager::MusicData::GetMusic()
 {
     if (m_music != nullptr) return m_music;
 
+    PROFILE_SCOPE("AssetManager::LoadMusic");
     CreateRWops(m_path, &m_rwops, &m_rwopsBuffer);
     m_music = Mix_LoadMUS_RW(m_rwops, 0);
     if (m_music == NULL)
@@ -379,8 +521,11 @@ Mix_Music *AssetManager::MusicData::GetMusic()
 }
 
 AssetManager::FontData::FontData(const std::string &path, int size) :
-    m_path(path), m_font(nullptr), m_size(size), m_rwops(nullptr), m_rwopsBuffer(nullptr)
+    m_path(path), m_font(nullptr), m_glyphStrip(nullptr), m_size(size),
+    m_rwops(nullptr), m_rwopsBuffer(nullptr)
 {
+    PROFILE_SCOPE("AssetManager::LoadFont");
+
     CreateRWops(m_path, &m_rwops, &m_rwopsBuffer);
     m_font = TTF_OpenFontRW(m_rwops, 0, size);
     if (m_font == NULL)
@@ -395,6 +540,7 @@ AssetManager::FontData::FontData(const std::string &path, int size) :
 
 AssetManager::FontData::~FontData()
 {
+    if (m_glyphStrip) delete m_glyphStrip;
     if (m_font) TTF_CloseFont(m_font);
     DestroyRWops(m_rwops, m_rwopsBuffer);
 }
@@ -404,9 +550,21 @@ TTF_Font *AssetManager::FontData::GetFont()
     return m_font;
 }
 
+GlyphStrip *AssetManager::FontData::GetGlyphStrip()
+{
+    if (m_glyphStrip == nullptr)
+    {
+        m_glyphStrip = new GlyphStrip(g_renderer, m_font);
+        AssertNew(m_glyphStrip);
+    }
+    return m_glyphStrip;
+}
+
 AssetManager::SoundData::SoundData(const std::string &path) :
     m_chunk(nullptr)
 {
+    PROFILE_SCOPE("AssetManager::LoadSound");
+
     void *rwopsBuffer = nullptr;
     SDL_RWops *rwops = nullptr;
     CreateRWops(path, &rwops, &rwopsBuffer);
@@ -444,10 +602,21 @@ AssetManager::SheetData::~SheetData()
     if (m_sheet) delete m_sheet;
 }
 
+bool AssetManager::SheetData::IsLoaded() const
+{
+    return m_sheet != nullptr;
+}
+
+const std::string &AssetManager::SheetData::GetPath() const
+{
+    return m_path;
+}
+
 SpriteSheet *AssetManager::SheetData::GetSpriteSheet()
 {
     if (m_sheet) return m_sheet;
 
+    PROFILE_SCOPE("AssetManager::LoadSpriteSheet");
     m_sheet = new SpriteSheet(g_renderer, m_path);
     return m_sheet;
 }
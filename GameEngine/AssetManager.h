@@ -10,6 +10,12 @@
 #include "Common.h"
 #include "SpriteSheet.h"
 #include "Color.h"
+#include "GlyphStrip.h"
+
+#include <atomic>
+#include <mutex>
+
+class AssetWatcher;
 
 class AssetManager
 {
@@ -28,6 +34,10 @@ public:
     int LoadSpriteSheets(const std::vector<int> &sheetIDs);
     SpriteSheet *GetSpriteSheet(int sheetID);
     TTF_Font *GetFont(int fontID);
+
+    /// @brief Renvoie les chiffres pr-rendus d'une police (voir UIDigitText).
+    /// La bande est cre au premier appel puis partage.
+    GlyphStrip *GetGlyphStrip(int fontID);
     const std::vector<SDL_Texture *> &GetBackgrounds();
     Mix_Chunk *GetSound(int soundID);
     Mix_Music *GetMusic(int musicID);
@@ -42,6 +52,19 @@ public:
     void FadeInMusic(int musicID, int loops = -1, int ms = 500, double position = 0.0);
     void FadeOutMusic(int ms = 500);
 
+    /// @brief Active le rechargement  chaud des feuilles de sprites
+    /// pour les gestionnaires crs aprs l'appel.
+    /// Les fichiers JSON et les textures des feuilles sont surveills,
+    /// puis relus sur un thread secondaire ds qu'ils sont modifis.
+    static void SetHotReloadEnabled(bool enabled);
+    static bool IsHotReloadEnabled();
+
+    /// @brief Applique les rechargements prpars par le thread de surveillance.
+    /// Cette mthode doit tre appele sur le thread de rendu.
+    /// @return Le nombre de feuilles recharges.
+    int ProcessReloads();
+    bool HasPendingReloads() const;
+
     static void CreateRWops(const std::string &path, SDL_RWops **rwops, void **buffer);
     static void DestroyRWops(SDL_RWops *rwops, void *buffer);
 
@@ -71,10 +94,12 @@ private:
         ~FontData();
 
         TTF_Font *GetFont();
+        GlyphStrip *GetGlyphStrip();
 
     private:
         std::string m_path;
         TTF_Font *m_font;
+        GlyphStrip *m_glyphStrip;
         int m_size;
         SDL_RWops *m_rwops;
         void *m_rwopsBuffer;
@@ -101,12 +126,30 @@ private:
         ~SheetData();
 
         SpriteSheet *GetSpriteSheet();
+        bool IsLoaded() const;
+        const std::string &GetPath() const;
 
     private:
         SpriteSheet *m_sheet;
         std::string m_path;
     };
 
+    struct WatchedSheet
+    {
+        int sheetID;
+        std::string jsonPath;
+    };
+
+    struct PendingReload
+    {
+        int sheetID;
+        SpriteSheet *staging;
+    };
+
+    SpriteSheet *LoadSheet(SheetData *sheetData);
+    void WatchTexture(SpriteSheet *spriteSheet);
+    void OnFileChanged(const std::string &path);
+
     std::vector<SDL_Texture *> m_backgrounds;
     std::map<int, SheetData *> m_sheetMap;
     std::map<int, SoundData *> m_soundMap;
@@ -115,4 +158,27 @@ private:
 
     std::vector<int> m_sfxChannels;
     int m_sfxIndex;
+
+    static bool s_hotReload;
+
+    AssetWatcher *m_watcher;
+
+    /// @brief Protge les chemins surveills et les rechargements en attente,
+    /// partags avec le thread de surveillance.
+    std::mutex m_reloadMutex;
+
+    /// @brief Identifiant de la feuille associe  chaque fichier surveill.
+    std::multimap<std::string, WatchedSheet> m_watchedPaths;
+    std::vector<PendingReload> m_pendingReloads;
+    std::atomic<int> m_pendingCount;
 };
+
+inline bool AssetManager::IsHotReloadEnabled()
+{
+    return s_hotReload;
+}
+
+inline bool AssetManager::HasPendingReloads() const
+{
+    return m_pendingCount > 0;
+}
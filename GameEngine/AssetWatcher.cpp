@@ -0,0 +1,211 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "AssetWatcher.h"
+
+#include <chrono>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#  include <poll.h>
+#  include <sys/inotify.h>
+#  include <unistd.h>
+#endif
+
+AssetWatcher::AssetWatcher(const std::function<void(const std::string &)> &onChanged) :
+    m_onChanged(onChanged), m_mutex(), m_files(), m_running(true)
+{
+#ifdef __linux__
+    m_inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotifyFD < 0)
+    {
+        std::cout
+            << "ERROR - inotify cannot be initialized" << std::endl
+            << "      - Modification times are polled instead" << std::endl;
+    }
+#endif
+
+    m_thread = std::thread(&AssetWatcher::Run, this);
+}
+
+AssetWatcher::~AssetWatcher()
+{
+    m_running = false;
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+#ifdef __linux__
+    if (m_inotifyFD >= 0)
+    {
+        close(m_inotifyFD);
+    }
+#endif
+}
+
+void AssetWatcher::AddFile(const std::string &path)
+{
+    WatchedFile file;
+    file.path = path;
+    file.writeTime = GetWriteTime(path);
+    file.changedMS = 0;
+
+    size_t pos = path.find_last_of("/\\");
+    if (pos == std::string::npos)
+    {
+        file.dir = "";
+        file.name = path;
+    }
+    else
+    {
+        file.dir = path.substr(0, pos);
+        file.name = path.substr(pos + 1);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const WatchedFile &watchedFile : m_files)
+    {
+        if (watchedFile.path == path) return;
+    }
+    m_files.push_back(file);
+
+#ifdef __linux__
+    AddWatch(file.dir);
+#endif
+}
+
+void AssetWatcher::Run()
+{
+    while (m_running)
+    {
+#ifdef __linux__
+        if (m_inotifyFD >= 0)
+        {
+            // Attente courte pour pouvoir s'arrter rapidement
+            struct pollfd pollFD = { m_inotifyFD, POLLIN, 0 };
+            if (poll(&pollFD, 1, 50) > 0)
+            {
+                ReadEvents(SDL_GetTicks64());
+            }
+        }
+        else
+#endif
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ASSET_WATCHER_POLL_MS));
+            PollWriteTimes(SDL_GetTicks64());
+        }
+
+        ReportChanges(SDL_GetTicks64());
+    }
+}
+
+void AssetWatcher::PollWriteTimes(Uint64 nowMS)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (WatchedFile &file : m_files)
+    {
+        int64_t writeTime = GetWriteTime(file.path);
+        if (writeTime >= 0 && writeTime != file.writeTime)
+        {
+            file.writeTime = writeTime;
+            file.changedMS = std::max<Uint64>(nowMS, 1);
+        }
+    }
+}
+
+void AssetWatcher::ReportChanges(Uint64 nowMS)
+{
+    std::vector<std::string> changedPaths;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (WatchedFile &file : m_files)
+        {
+            if (file.changedMS == 0) continue;
+            if (nowMS - file.changedMS < ASSET_WATCHER_DEBOUNCE_MS) continue;
+
+            file.changedMS = 0;
+            changedPaths.push_back(file.path);
+        }
+    }
+
+    // La fonction est appele sans verrou, elle peut ajouter des fichiers
+    for (const std::string &path : changedPaths)
+    {
+        m_onChanged(path);
+    }
+}
+
+void AssetWatcher::MarkChanged(const std::string &dir, const std::string &name, Uint64 nowMS)
+{
+    for (WatchedFile &file : m_files)
+    {
+        if (file.name == name && file.dir == dir)
+        {
+            file.changedMS = std::max<Uint64>(nowMS, 1);
+        }
+    }
+}
+
+int64_t AssetWatcher::GetWriteTime(const std::string &path)
+{
+#ifdef _WIN32
+    struct _stat64 info;
+    if (_stat64(path.c_str(), &info) != 0) return -1;
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) return -1;
+#endif
+    return (int64_t)info.st_mtime;
+}
+
+#ifdef __linux__
+void AssetWatcher::AddWatch(const std::string &dir)
+{
+    if (m_inotifyFD < 0) return;
+
+    for (auto it = m_watchDirs.begin(); it != m_watchDirs.end(); ++it)
+    {
+        if (it->second == dir) return;
+    }
+
+    const char *dirPath = dir.empty() ? "." : dir.c_str();
+    int watchID = inotify_add_watch(
+        m_inotifyFD, dirPath, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE
+    );
+    if (watchID < 0)
+    {
+        std::cout << "ERROR - The directory " << dirPath << " cannot be watched" << std::endl;
+        return;
+    }
+    m_watchDirs[watchID] = dir;
+}
+
+void AssetWatcher::ReadEvents(Uint64 nowMS)
+{
+    alignas(struct inotify_event) char buffer[4096];
+    while (true)
+    {
+        ssize_t length = read(m_inotifyFD, buffer, sizeof(buffer));
+        if (length <= 0) break;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (char *ptr = buffer; ptr < buffer + length; )
+        {
+            const struct inotify_event *event = (const struct inotify_event *)ptr;
+            ptr += sizeof(struct inotify_event) + event->len;
+
+            if (event->len == 0) continue;
+
+            auto it = m_watchDirs.find(event->wd);
+            if (it == m_watchDirs.end()) continue;
+
+            MarkChanged(it->second, std::string(event->name), nowMS);
+        }
+    }
+}
+#endif
@@ -0,0 +1,76 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// @brief Dlai sans nouvelle modification avant de signaler un fichier
+/// (en millisecondes). Les diteurs crivent souvent un fichier en plusieurs fois.
+#define ASSET_WATCHER_DEBOUNCE_MS 150
+
+/// @brief Priode de scrutation des dates de modification, lorsque inotify
+/// n'est pas disponible (en millisecondes).
+#define ASSET_WATCHER_POLL_MS 250
+
+/// @brief Surveille des fichiers sur un thread secondaire.
+/// Sous Linux, les dossiers des fichiers sont surveills avec inotify,
+/// ce qui dtecte aussi les fichiers remplacs par renommage.
+/// Sur les autres systmes, les dates de modification sont scrutes.
+class AssetWatcher
+{
+public:
+    /// @brief Construit et dmarre le thread de surveillance.
+    /// @param onChanged la fonction appele sur le thread de surveillance
+    /// avec le chemin de chaque fichier modifi.
+    AssetWatcher(const std::function<void(const std::string &)> &onChanged);
+    AssetWatcher(AssetWatcher const&) = delete;
+    AssetWatcher& operator=(AssetWatcher const&) = delete;
+    ~AssetWatcher();
+
+    /// @brief Ajoute un fichier  surveiller.
+    /// @param path le chemin du fichier, transmis tel quel  la fonction de rappel.
+    void AddFile(const std::string &path);
+
+    /// @brief Renvoie la date de modification d'un fichier (-1 s'il est absent).
+    static int64_t GetWriteTime(const std::string &path);
+
+private:
+    struct WatchedFile
+    {
+        std::string path;
+        std::string dir;
+        std::string name;
+        int64_t writeTime;
+
+        /// @brief Instant de la dernire modification non signale (0 si aucune).
+        Uint64 changedMS;
+    };
+
+    void Run();
+    void PollWriteTimes(Uint64 nowMS);
+    void ReportChanges(Uint64 nowMS);
+    void MarkChanged(const std::string &dir, const std::string &name, Uint64 nowMS);
+
+    std::function<void(const std::string &)> m_onChanged;
+    std::mutex m_mutex;
+    std::vector<WatchedFile> m_files;
+    std::atomic<bool> m_running;
+    std::thread m_thread;
+
+#ifdef __linux__
+    void AddWatch(const std::string &dir);
+    void ReadEvents(Uint64 nowMS);
+
+    int m_inotifyFD;
+    std::map<int, std::string> m_watchDirs;
+#endif
+};
@@ -9,6 +9,8 @@
 SDL_Renderer *g_renderer(nullptr);
 SDL_Window *g_window(nullptr);
 
+static Uint64 s_renderResetCount = 0;
+
 int Game_Init(Uint32 sdlFlags, Uint32 imgFlags, Uint32 mixFlags, int channelCount)
 {
     // Initialise la SDL2
@@ -55,3 +57,13 @@ void Game_Quit()
     IMG_Quit();
     SDL_Quit();
 }
+
+void Game_OnRenderReset()
+{
+    s_renderResetCount++;
+}
+
+Uint64 Game_GetRenderResetCount()
+{
+    return s_renderResetCount;
+}
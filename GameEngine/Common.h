@@ -20,3 +20,13 @@ int Game_Init(Uint32 sdlFlags, Uint32 imgFlags, Uint32 mixFlags, int channelCoun
 
 /// @brief Quitte les librairies utilises par le jeu.
 void Game_Quit();
+
+/// @brief Signale la perte du contenu des textures cibles
+/// (SDL_RENDER_TARGETS_RESET ou SDL_RENDER_DEVICE_RESET).
+/// Appele par InputManager::ProcessEvents().
+void Game_OnRenderReset();
+
+/// @brief Renvoie le nombre de pertes des textures cibles depuis le lancement.
+/// Les objets qui conservent une image dans une texture cible
+/// recrent cette texture lorsque ce nombre change.
+Uint64 Game_GetRenderResetCount();
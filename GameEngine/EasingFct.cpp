@@ -8,36 +8,27 @@
 
 float EasingFct_Linear(float x)
 {
-    return x;
+    return EaseLinear()(x);
 }
 
 float EasingFct_In(float x)
 {
-    return x * x;
+    return EaseIn()(x);
 }
 
 float EasingFct_Out(float x)
 {
-    float t = 1 - x;
-    return 1.f - t * t;
+    return EaseOut()(x);
 }
 
 float EasingFct_InOut(float x)
 {
-    if (x < 0.5f)
-    {
-        return 2.f * x * x;
-    }
-    else
-    {
-        float t = 1 - x;
-        return 1.f - 2.f * t * t;
-    }
+    return EaseInOut()(x);
 }
 
 float EasingFct_Cos(float x)
 {
-    return 0.5f * (1.f - cosf(b2_pi * x));
+    return EaseCos()(x);
 }
 
 float EasingFct_Shake2(float t)
@@ -59,4 +50,20 @@ float EasingFct_Shake4(float t)
     const float count = 4.5f;
     float coeff = 1.f - t * t;
     return cosf(count * 2.f * b2_pi * t - 0.5f * b2_pi) * coeff * coeff;
-}
\ No newline at end of file
+}
+
+void EasingFct_Evaluate(EasingFct easing, const float *x, float *y, int count)
+{
+    if (easing == EasingFct_Linear)
+        EasingFct_Evaluate(EaseLinear(), x, y, count);
+    else if (easing == EasingFct_In)
+        EasingFct_Evaluate(EaseIn(), x, y, count);
+    else if (easing == EasingFct_Out)
+        EasingFct_Evaluate(EaseOut(), x, y, count);
+    else if (easing == EasingFct_InOut)
+        EasingFct_Evaluate(EaseInOut(), x, y, count);
+    else if (easing == EasingFct_Cos)
+        EasingFct_Evaluate(EaseCos(), x, y, count);
+    else
+        EasingFct_Evaluate(EaseDynamic{ easing }, x, y, count);
+}
@@ -47,3 +47,92 @@ float EasingFct_Cos(float x);
 float EasingFct_Shake2(float t);
 float EasingFct_Shake3(float t);
 float EasingFct_Shake4(float t);
+
+/// @ingroup Animator
+/// @brief Courbe d'acclration linaire, sous forme d'objet fonction.
+/// Contrairement aux pointeurs EasingFct, les objets fonctions Ease*
+/// sont connus  la compilation et leur appel est dvelopp en ligne.
+struct EaseLinear
+{
+    constexpr float operator()(float x) const { return x; }
+};
+
+/// @ingroup Animator
+/// @brief Courbe d'acclration douce en entre, sous forme d'objet fonction.
+struct EaseIn
+{
+    constexpr float operator()(float x) const { return x * x; }
+};
+
+/// @ingroup Animator
+/// @brief Courbe d'acclration douce en sortie, sous forme d'objet fonction.
+struct EaseOut
+{
+    constexpr float operator()(float x) const
+    {
+        const float t = 1.f - x;
+        return 1.f - t * t;
+    }
+};
+
+/// @ingroup Animator
+/// @brief Courbe d'acclration douce en entre et en sortie, sous forme d'objet fonction.
+/// Les deux branches sont calcules puis slectionnes, sans saut.
+struct EaseInOut
+{
+    constexpr float operator()(float x) const
+    {
+        const float t = 1.f - x;
+        const float a = 2.f * x * x;
+        const float b = 1.f - 2.f * t * t;
+        return x < 0.5f ? a : b;
+    }
+};
+
+/// @ingroup Animator
+/// @brief Courbe d'acclration dfinie  partir du cosinus, sous forme d'objet fonction.
+struct EaseCos
+{
+    float operator()(float x) const { return 0.5f * (1.f - cosf(b2_pi * x)); }
+};
+
+/// @ingroup Animator
+/// @brief Courbe d'acclration choisie  l'excution.
+/// Utilise par dfaut par LerpAnim pour appliquer la courbe
+/// dfinie par Animation::SetEasing().
+struct EaseDynamic
+{
+    EasingFct fct = EasingFct_Linear;
+
+    float operator()(float x) const { return fct(x); }
+};
+
+/// @ingroup Animator
+/// @brief Evalue une courbe d'acclration sur un tableau de ratios.
+/// Pour les objets fonctions Ease*, la boucle ne contient ni appel indirect
+/// ni saut et peut tre vectorise par le compilateur.
+/// @param[in] easing la courbe d'acclration.
+/// @param[in] x les ratios, ramens entre 0.f et 1.f.
+/// @param[out] y les ratios de progression.
+/// @param[in] count le nombre de ratios.
+template <class Easing>
+inline void EasingFct_Evaluate(Easing easing, const float *x, float *y, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float t = x[i];
+        t = t < 0.f ? 0.f : t;
+        t = t > 1.f ? 1.f : t;
+        y[i] = easing(t);
+    }
+}
+
+/// @ingroup Animator
+/// @brief Evalue une courbe d'acclration sur un tableau de ratios.
+/// Les courbes prdfinies (EasingFct_Linear, EasingFct_InOut...) sont
+/// remplaces par leur objet fonction.
+/// @param[in] easing la courbe d'acclration.
+/// @param[in] x les ratios, ramens entre 0.f et 1.f.
+/// @param[out] y les ratios de progression.
+/// @param[in] count le nombre de ratios.
+void EasingFct_Evaluate(EasingFct easing, const float *x, float *y, int count);
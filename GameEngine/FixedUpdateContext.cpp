@@ -0,0 +1,105 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "FixedUpdateContext.h"
+#include "Scene.h"
+#include "GameBody.h"
+
+FixedUpdateContext::FixedUpdateContext(Scene *scene) :
+    m_scene(scene), m_commands(), m_deferred()
+{
+}
+
+float FixedUpdateContext::GetDelta() const
+{
+    return m_scene->GetDelta();
+}
+
+RayHit FixedUpdateContext::RayCastFirst(
+    b2Vec2 point1, b2Vec2 point2, const QueryFilter &filter)
+{
+    return m_scene->RayCastFirst(point1, point2, filter);
+}
+
+void FixedUpdateContext::OverlapCircle(
+    b2Vec2 center, float radius,
+    const QueryFilter &filter, std::vector<OverlapResult> &result)
+{
+    m_scene->OverlapCircle(center, radius, filter, result);
+}
+
+void FixedUpdateContext::OverlapBox(
+    b2Vec2 center, b2Vec2 halfExtents, float angleDeg,
+    const QueryFilter &filter, std::vector<OverlapResult> &result)
+{
+    m_scene->OverlapBox(center, halfExtents, angleDeg, filter, result);
+}
+
+void FixedUpdateContext::ApplyLinearImpulse(GameBody *gameBody, b2Vec2 impulse)
+{
+    m_commands.push_back(Command{ CommandType::IMPULSE, gameBody, impulse, -1 });
+}
+
+void FixedUpdateContext::ApplyForce(GameBody *gameBody, b2Vec2 force)
+{
+    m_commands.push_back(Command{ CommandType::FORCE, gameBody, force, -1 });
+}
+
+void FixedUpdateContext::SetLinearVelocity(GameBody *gameBody, b2Vec2 velocity)
+{
+    m_commands.push_back(Command{ CommandType::VELOCITY, gameBody, velocity, -1 });
+}
+
+void FixedUpdateContext::Delete(GameObject *gameObject)
+{
+    m_commands.push_back(Command{ CommandType::DELETE_OBJECT, gameObject, b2Vec2_zero, -1 });
+}
+
+void FixedUpdateContext::Defer(const std::function<void()> &command)
+{
+    int deferredIndex = (int)m_deferred.size();
+    m_deferred.push_back(command);
+    m_commands.push_back(Command{ CommandType::DEFERRED, nullptr, b2Vec2_zero, deferredIndex });
+}
+
+void FixedUpdateContext::Apply()
+{
+    for (Command &command : m_commands)
+    {
+        GameBody *gameBody = nullptr;
+        b2Body *body = nullptr;
+        if (command.type == CommandType::IMPULSE ||
+            command.type == CommandType::FORCE ||
+            command.type == CommandType::VELOCITY)
+        {
+            gameBody = (GameBody *)command.gameObject;
+            body = gameBody->GetBody();
+            if (body == nullptr) continue;
+        }
+
+        switch (command.type)
+        {
+        case CommandType::IMPULSE:
+            body->ApplyLinearImpulseToCenter(command.value, true);
+            break;
+        case CommandType::FORCE:
+            body->ApplyForceToCenter(command.value, true);
+            break;
+        case CommandType::VELOCITY:
+            body->SetLinearVelocity(command.value);
+            break;
+        case CommandType::DELETE_OBJECT:
+            command.gameObject->Delete();
+            break;
+        case CommandType::DEFERRED:
+        default:
+            m_deferred[command.deferredIndex]();
+            break;
+        }
+    }
+    m_commands.clear();
+    m_deferred.clear();
+}
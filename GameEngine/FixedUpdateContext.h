@@ -0,0 +1,70 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#include <functional>
+
+class Scene;
+class GameObject;
+class GameBody;
+class RayHit;
+struct QueryFilter;
+struct OverlapResult;
+
+/// @brief Contexte transmis  GameObject::ParallelFixedUpdate().
+/// Les requtes sur le monde physique sont en lecture seule et les
+/// modifications de la scne sont enregistres dans une file de commandes,
+/// applique squentiellement aprs la phase parallle.
+class FixedUpdateContext
+{
+public:
+    FixedUpdateContext(Scene *scene);
+
+    float GetDelta() const;
+
+    RayHit RayCastFirst(b2Vec2 point1, b2Vec2 point2, const QueryFilter &filter);
+    void OverlapCircle(
+        b2Vec2 center, float radius,
+        const QueryFilter &filter, std::vector<OverlapResult> &result
+    );
+    void OverlapBox(
+        b2Vec2 center, b2Vec2 halfExtents, float angleDeg,
+        const QueryFilter &filter, std::vector<OverlapResult> &result
+    );
+
+    void ApplyLinearImpulse(GameBody *gameBody, b2Vec2 impulse);
+    void ApplyForce(GameBody *gameBody, b2Vec2 force);
+    void SetLinearVelocity(GameBody *gameBody, b2Vec2 velocity);
+    void Delete(GameObject *gameObject);
+
+    /// @brief Enregistre une commande quelconque (cration d'objets, dgts...).
+    /// @param command la commande excute aprs la phase parallle.
+    void Defer(const std::function<void()> &command);
+
+    /// @brief Excute les commandes dans leur ordre d'enregistrement puis vide la file.
+    void Apply();
+
+private:
+    enum class CommandType : uint32_t
+    {
+        IMPULSE, FORCE, VELOCITY, DELETE_OBJECT, DEFERRED
+    };
+
+    struct Command
+    {
+        CommandType type;
+        GameObject *gameObject;
+        b2Vec2 value;
+        int deferredIndex;
+    };
+
+    Scene *m_scene;
+    std::vector<Command> m_commands;
+    std::vector<std::function<void()>> m_deferred;
+};
@@ -0,0 +1,102 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "FrameArena.h"
+
+FrameArena::FrameArena(size_t blockSize) :
+    m_blockSize(blockSize), m_blocks(),
+    m_blockIndex(0), m_offset(0), m_usedBefore(0), m_peakBytes(0)
+{
+    assert(blockSize > 0);
+}
+
+FrameArena::~FrameArena()
+{
+    for (Block &block : m_blocks)
+    {
+        delete[] block.data;
+    }
+}
+
+void *FrameArena::Allocate(size_t size, size_t alignment)
+{
+    // L'alignement doit tre une puissance de deux
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    while (true)
+    {
+        if (m_blockIndex < (int)m_blocks.size())
+        {
+            Block &block = m_blocks[m_blockIndex];
+            uintptr_t address = (uintptr_t)(block.data + m_offset);
+            size_t padding = (size_t)((alignment - (address & (alignment - 1))) & (alignment - 1));
+
+            if (m_offset + padding + size <= block.size)
+            {
+                void *ptr = block.data + m_offset + padding;
+                m_offset += padding + size;
+                m_peakBytes = std::max(m_peakBytes, GetUsedBytes());
+                return ptr;
+            }
+
+            // Passe au bloc suivant
+            m_usedBefore += block.size;
+            m_blockIndex++;
+            m_offset = 0;
+            continue;
+        }
+
+        Block block = { 0 };
+        block.size = std::max(m_blockSize, size + alignment);
+        block.data = new unsigned char[block.size];
+        AssertNew(block.data);
+        m_blocks.push_back(block);
+    }
+}
+
+void FrameArena::Reset()
+{
+    if (m_blocks.size() > 1)
+    {
+        // Fusionne les blocs pour servir les frames suivantes sans dbordement
+        size_t capacity = GetCapacity();
+        for (Block &block : m_blocks)
+        {
+            delete[] block.data;
+        }
+        m_blocks.clear();
+
+        Block block = { 0 };
+        block.size = capacity;
+        block.data = new unsigned char[block.size];
+        AssertNew(block.data);
+        m_blocks.push_back(block);
+    }
+
+    m_blockIndex = 0;
+    m_offset = 0;
+    m_usedBefore = 0;
+}
+
+void FrameArena::Rewind(const FrameArenaMarker &marker)
+{
+    assert(marker.blockIndex < m_blockIndex ||
+        (marker.blockIndex == m_blockIndex && marker.offset <= m_offset));
+
+    m_blockIndex = marker.blockIndex;
+    m_offset = marker.offset;
+    m_usedBefore = marker.usedBytes;
+}
+
+size_t FrameArena::GetCapacity() const
+{
+    size_t capacity = 0;
+    for (const Block &block : m_blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
@@ -0,0 +1,204 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#include <cstddef>
+
+#define FRAME_ARENA_BLOCK_SIZE (64 * 1024)
+
+/// @brief Position dans une FrameArena, obtenue avec GetMarker().
+struct FrameArenaMarker
+{
+    int blockIndex;
+    size_t offset;
+    size_t usedBytes;
+};
+
+/// @brief Allocateur linaire pour les donnes temporaires d'une frame
+/// ou d'un pas fixe.
+/// Les allocations avancent un curseur dans de grands blocs rutiliss
+/// d'une frame  l'autre. La mmoire n'est jamais libre individuellement :
+/// elle est rendue en une fois par Reset() ou Rewind().
+/// Une arne ne doit tre utilise que par un seul thread.
+class FrameArena
+{
+public:
+    /// @brief Construit une arne vide.
+    /// Le premier bloc n'est allou qu' la premire allocation.
+    /// @param blockSize la taille minimale des blocs (en octets).
+    FrameArena(size_t blockSize = FRAME_ARENA_BLOCK_SIZE);
+    FrameArena(FrameArena const&) = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+    ~FrameArena();
+
+    /// @brief Alloue une zone mmoire dans l'arne.
+    /// @param size la taille de la zone (en octets).
+    /// @param alignment l'alignement de la zone (puissance de deux).
+    /// @return Un pointeur vers la zone, valide jusqu'au prochain Reset().
+    void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// @brief Alloue un tableau non initialis dans l'arne.
+    /// @tparam T le type des lments.
+    /// @param count le nombre d'lments.
+    template <class T>
+    T *AllocateArray(size_t count);
+
+    /// @brief Rend toute la mmoire alloue depuis le dernier Reset().
+    /// Si plusieurs blocs ont t ncessaires, ils sont fusionns en un seul
+    /// bloc, suffisant pour les frames suivantes.
+    void Reset();
+
+    FrameArenaMarker GetMarker() const;
+
+    /// @brief Rend la mmoire alloue depuis l'obtention d'un marqueur.
+    /// @param marker le marqueur renvoy par GetMarker().
+    void Rewind(const FrameArenaMarker &marker);
+
+    /// @brief Renvoie le nombre d'octets allous depuis le dernier Reset().
+    size_t GetUsedBytes() const;
+
+    /// @brief Renvoie le nombre maximal d'octets allous entre deux Reset().
+    size_t GetPeakBytes() const;
+    size_t GetCapacity() const;
+
+private:
+    struct Block
+    {
+        unsigned char *data;
+        size_t size;
+    };
+
+    size_t m_blockSize;
+    std::vector<Block> m_blocks;
+
+    /// @brief Indice du bloc courant et position du curseur dans ce bloc.
+    int m_blockIndex;
+    size_t m_offset;
+
+    /// @brief Taille des blocs prcdant le bloc courant.
+    size_t m_usedBefore;
+    size_t m_peakBytes;
+};
+
+/// @brief Porte dont les allocations sont rendues  l'arne  sa sortie.
+class FrameArenaScope
+{
+public:
+    FrameArenaScope(FrameArena &arena);
+    FrameArenaScope(FrameArenaScope const&) = delete;
+    FrameArenaScope& operator=(FrameArenaScope const&) = delete;
+    ~FrameArenaScope();
+
+private:
+    FrameArena &m_arena;
+    FrameArenaMarker m_marker;
+};
+
+/// @brief Allocateur compatible avec la STL qui alloue dans une FrameArena.
+/// Les librations sont ignores ; un conteneur utilisant cet allocateur
+/// ne doit pas survivre au Reset() de son arne.
+/// @tparam T le type des lments allous.
+template <class T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    ArenaAllocator(FrameArena *arena) noexcept;
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept;
+
+    T *allocate(size_t count);
+    void deallocate(T *ptr, size_t count) noexcept;
+
+    FrameArena *GetArena() const noexcept;
+
+private:
+    FrameArena *m_arena;
+};
+
+/// @brief Tableau dynamique allou dans une FrameArena.
+template <class T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template <class T>
+inline T *FrameArena::AllocateArray(size_t count)
+{
+    return static_cast<T *>(Allocate(count * sizeof(T), alignof(T)));
+}
+
+inline FrameArenaMarker FrameArena::GetMarker() const
+{
+    return FrameArenaMarker{ m_blockIndex, m_offset, m_usedBefore };
+}
+
+inline size_t FrameArena::GetUsedBytes() const
+{
+    return m_usedBefore + m_offset;
+}
+
+inline size_t FrameArena::GetPeakBytes() const
+{
+    return m_peakBytes;
+}
+
+inline FrameArenaScope::FrameArenaScope(FrameArena &arena) :
+    m_arena(arena), m_marker(arena.GetMarker())
+{
+}
+
+inline FrameArenaScope::~FrameArenaScope()
+{
+    m_arena.Rewind(m_marker);
+}
+
+template <class T>
+inline ArenaAllocator<T>::ArenaAllocator(FrameArena *arena) noexcept :
+    m_arena(arena)
+{
+}
+
+template <class T>
+template <class U>
+inline ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U> &other) noexcept :
+    m_arena(other.GetArena())
+{
+}
+
+template <class T>
+inline T *ArenaAllocator<T>::allocate(size_t count)
+{
+    return m_arena->AllocateArray<T>(count);
+}
+
+template <class T>
+inline void ArenaAllocator<T>::deallocate(T *ptr, size_t count) noexcept
+{
+}
+
+template <class T>
+inline FrameArena *ArenaAllocator<T>::GetArena() const noexcept
+{
+    return m_arena;
+}
+
+template <class T, class U>
+inline bool operator==(const ArenaAllocator<T> &allocA, const ArenaAllocator<U> &allocB)
+{
+    return allocA.GetArena() == allocB.GetArena();
+}
+
+template <class T, class U>
+inline bool operator!=(const ArenaAllocator<T> &allocA, const ArenaAllocator<U> &allocB)
+{
+    return allocA.GetArena() != allocB.GetArena();
+}
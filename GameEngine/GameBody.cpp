@@ -13,13 +13,24 @@ GameBody::GameBody(Scene *scene, int layer) :
     GameObject(scene, layer), m_startPos(b2Vec2_zero),
     m_body(nullptr), m_debugColor(0, 200, 255),
     m_currXf(b2Vec2(0.f, 0.f), b2Rot(0.f)),
-    m_lastXf(b2Vec2(0.f, 0.f), b2Rot(0.f))
+    m_lastXf(b2Vec2(0.f, 0.f), b2Rot(0.f)),
+    m_contactEvents(CONTACT_ALL), m_contactCategories(0xFFFF)
 {
     SetName("GameBody");
 }
 
 GameBody::~GameBody()
 {
+    m_scene->GetTriggerSystem().RemoveGameBody(this);
+    DeleteBody();
+}
+
+void GameBody::OnRecycle()
+{
+    GameObject::OnRecycle();
+
+    // Le corps est recr par Start() lorsque l'objet est rutilis
+    m_scene->GetTriggerSystem().RemoveGameBody(this);
     DeleteBody();
 }
 
@@ -35,6 +46,18 @@ void GameBody::OnCollisionExit(GameCollision &collision)
 {
 }
 
+void GameBody::OnTriggerEnter(const TriggerEvent &event)
+{
+}
+
+void GameBody::OnTriggerStay(const TriggerEvent &event)
+{
+}
+
+void GameBody::OnTriggerExit(const TriggerEvent &event)
+{
+}
+
 GameBody *GameBody::GetFromBody(b2Body *body)
 {
     assert(body);
@@ -10,6 +10,7 @@
 #include "GameObject.h"
 
 class GameCollision;
+struct TriggerEvent;
 
 class GameBody : public GameObject
 {
@@ -19,11 +20,31 @@ public:
 
     virtual void OnDisable() override;
     virtual void OnEnable() override;
+    virtual void OnRecycle() override;
 
     virtual void OnCollisionEnter(GameCollision &collision);
     virtual void OnCollisionStay(GameCollision &collision);
     virtual void OnCollisionExit(GameCollision &collision);
 
+    /// @brief Messages envoys par le TriggerSystem de la scne
+    /// lorsqu'un acteur entre, reste ou sort d'un volume de l'objet.
+    virtual void OnTriggerEnter(const TriggerEvent &event);
+    virtual void OnTriggerStay(const TriggerEvent &event);
+    virtual void OnTriggerExit(const TriggerEvent &event);
+
+    /// @brief Dfinit les messages de collision reus par l'objet.
+    /// Par dfaut, l'objet reoit tous les messages pour toutes les catgories.
+    /// @param eventMask combinaison de valeurs ContactEvent.
+    /// @param categoryMask catgories des fixtures de l'autre corps.
+    void SetContactEvents(uint32_t eventMask, uint16 categoryMask = 0xFFFF);
+    uint32_t GetContactEvents() const;
+    uint16 GetContactCategories() const;
+
+    /// @brief Indique si l'objet doit recevoir un message de collision.
+    /// @param event le message.
+    /// @param categoryBits les catgories de la fixture de l'autre corps.
+    bool ListensContact(ContactEvent event, uint16 categoryBits) const;
+
     static GameBody *GetFromBody(b2Body *body);
 
     b2Body *CreateBody(b2BodyDef *bodyDef);
@@ -60,6 +81,12 @@ private:
     b2Vec2 m_startPos;
     b2Transform m_lastXf;
     b2Transform m_currXf;
+
+    /// @brief Messages de collision auxquels l'objet est abonn.
+    uint32_t m_contactEvents;
+
+    /// @brief Catgories des fixtures pour lesquelles l'objet reoit les messages.
+    uint16 m_contactCategories;
 };
 
 inline b2Body *GameBody::GetBody()
@@ -124,3 +151,24 @@ inline void GameBody::UpdateInterpolation()
         m_currXf = m_body->GetTransform();
     }
 }
+
+inline void GameBody::SetContactEvents(uint32_t eventMask, uint16 categoryMask)
+{
+    m_contactEvents = eventMask;
+    m_contactCategories = categoryMask;
+}
+
+inline uint32_t GameBody::GetContactEvents() const
+{
+    return m_contactEvents;
+}
+
+inline uint16 GameBody::GetContactCategories() const
+{
+    return m_contactCategories;
+}
+
+inline bool GameBody::ListensContact(ContactEvent event, uint16 categoryBits) const
+{
+    return ((m_contactEvents & event) != 0) && ((m_contactCategories & categoryBits) != 0);
+}
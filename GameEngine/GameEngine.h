@@ -13,6 +13,8 @@
 #include "Timer.h"
 #include "SpriteSheet.h"
 #include "Text.h"
+#include "GlyphStrip.h"
+#include "AnimationSystem.h"
 #include "Animation.h"
 #include "SpriteAnim.h"
 #include "LerpAnim.h"
@@ -28,6 +30,7 @@
 
 #include "GameObject.h"
 #include "GameBody.h"
+#include "KinematicPathMover.h"
 #include "Camera.h"
 #include "ParticleSystem.h"
 
@@ -42,6 +45,8 @@
 #include "UIFillRect.h"
 #include "UIImage.h"
 #include "UIText.h"
+#include "UIDigitText.h"
+#include "UIProfilerOverlay.h"
 
 #include "UIButton.h"
 #include "UIItemList.h"
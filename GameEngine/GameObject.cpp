@@ -10,14 +10,31 @@
 
 
 GameObject::GameObject(Scene *scene, int layer) :
-    m_scene(scene), m_enabled(false), m_layer(layer),
+    m_scene(scene), m_enabled(false), m_parallelFixedUpdate(false), m_layer(layer),
     m_children(), m_parent(nullptr), m_depth(0), m_name(), m_flags(Flag::NONE),
-    m_objectID(-1), m_delays(), m_fixedDelays()
+    m_objectID(-1), m_delays(), m_fixedDelays(),
+    m_delayTimer(), m_fixedDelayTimer(), m_pool(nullptr)
 {
     SetName("GameObject");
     scene->m_objectManager.AddObject(this);
 }
 
+void GameObject::Reactivate()
+{
+    assert(m_parent == nullptr && m_children.empty());
+
+    m_enabled = false;
+    m_depth = 0;
+    m_flags = Flag::NONE;
+    m_scene->m_objectManager.AddObject(this);
+
+    // Les comptes à rebours reprennent avec l'objet
+    if (m_delays.empty() == false)
+        ScheduleDelays(m_scene->GetTimers(), m_delays, m_delayTimer);
+    if (m_fixedDelays.empty() == false)
+        ScheduleDelays(m_scene->GetFixedTimers(), m_fixedDelays, m_fixedDelayTimer);
+}
+
 void GameObject::AddChild(GameObject *child)
 {
     assert(child);
@@ -65,6 +82,7 @@ void GameObject::SetParent(GameObject *parent)
 GameObject::~GameObject()
 {
     // C'est la scene qui s'occupe de supprimer les objets fils
+    CancelDelays();
 }
 
 void GameObject::DrawGizmos(Gizmos &gizmos)
@@ -73,11 +91,15 @@ void GameObject::DrawGizmos(Gizmos &gizmos)
 
 void GameObject::FixedUpdate()
 {
-    for (float *delay : m_fixedDelays)
-    {
-        *delay -= m_scene->GetDelta();
-        if (*delay < 0.f) *delay = -1.f;
-    }
+}
+
+void GameObject::ParallelFixedUpdate(FixedUpdateContext &context)
+{
+}
+
+const void *GameObject::GetParallelWriteKey() const
+{
+    return this;
 }
 
 void GameObject::OnDisable()
@@ -98,14 +120,73 @@ void GameObject::Start()
 
 void GameObject::Update()
 {
-    for (auto it = m_delays.begin(); it != m_delays.end(); ++it)
-    {
-        float *delay = it->first;
-        *delay -= (it->second) ? m_scene->GetDelta() : m_scene->GetTime().GetUnscaledDelta();
-        if (*delay < 0.f) *delay = -1.f;
-    }
 }
 
 void GameObject::OnDelete()
 {
 }
+
+void GameObject::AddUpdateDelay(float *delay)
+{
+    if (std::find(m_delays.begin(), m_delays.end(), delay) != m_delays.end())
+        return;
+
+    m_delays.push_back(delay);
+    if (m_delays.size() == 1)
+        ScheduleDelays(m_scene->GetTimers(), m_delays, m_delayTimer);
+}
+
+void GameObject::RemoveUpdateDelay(float *delay)
+{
+    m_delays.erase(std::remove(m_delays.begin(), m_delays.end(), delay), m_delays.end());
+    if (m_delays.empty())
+        m_scene->GetTimers().Cancel(m_delayTimer);
+}
+
+void GameObject::AddFixedUpdateDelay(float *delay)
+{
+    if (std::find(m_fixedDelays.begin(), m_fixedDelays.end(), delay) != m_fixedDelays.end())
+        return;
+
+    m_fixedDelays.push_back(delay);
+    if (m_fixedDelays.size() == 1)
+        ScheduleDelays(m_scene->GetFixedTimers(), m_fixedDelays, m_fixedDelayTimer);
+}
+
+void GameObject::RemoveFixedUpdateDelay(float *delay)
+{
+    m_fixedDelays.erase(
+        std::remove(m_fixedDelays.begin(), m_fixedDelays.end(), delay), m_fixedDelays.end()
+    );
+    if (m_fixedDelays.empty())
+        m_scene->GetFixedTimers().Cancel(m_fixedDelayTimer);
+}
+
+void GameObject::ScheduleDelays(
+    TimerWheel &timers, std::vector<float *> &delays, TimerHandle &handle)
+{
+    // La minuterie décrémente les comptes à rebours puis se reprogramme
+    // au tick suivant, la valeur pouvant être modifiée à tout moment
+    handle = timers.Schedule(timers.GetTickDuration(), [this, &timers, &delays, &handle]()
+    {
+        const float elapsed = timers.GetTickDuration();
+        for (float *delay : delays)
+        {
+            *delay -= elapsed;
+            if (*delay < 0.f) *delay = -1.f;
+        }
+        ScheduleDelays(timers, delays, handle);
+    });
+}
+
+void GameObject::CancelDelays()
+{
+    m_scene->GetTimers().Cancel(m_delayTimer);
+    m_scene->GetFixedTimers().Cancel(m_fixedDelayTimer);
+}
+
+void GameObject::OnRecycle()
+{
+    // Les comptes à rebours sont conservés mais ne sont plus décrémentés
+    CancelDelays();
+}
@@ -9,8 +9,11 @@
 #include "Settings.h"
 #include "Common.h"
 #include "Gizmos.h"
+#include "TimerWheel.h"
 
 class Scene;
+class FixedUpdateContext;
+class ObjectPoolBase;
 
 class GameObject
 {
@@ -29,6 +32,25 @@ public:
     virtual void Update();
     virtual void OnDelete();
 
+    /// @brief Mthode appele lorsque l'objet supprim est rendu  un pool
+    /// de recyclage au lieu d'tre dtruit. L'objet doit y librer
+    /// les ressources cres par Start().
+    virtual void OnRecycle();
+
+    /// @brief Mthode appele  chaque pas fixe sur un thread du systme de jobs,
+    /// aprs la mise  jour du moteur physique et avant FixedUpdate().
+    /// L'objet ne peut modifier que ses propres donnes, les autres
+    /// modifications passent par les commandes du contexte.
+    /// @param context le contexte de la phase parallle.
+    virtual void ParallelFixedUpdate(FixedUpdateContext &context);
+
+    /// @brief Renvoie la cl des donnes partages modifies par ParallelFixedUpdate().
+    /// Les objets de mme cl sont mis  jour squentiellement dans un mme job.
+    virtual const void *GetParallelWriteKey() const;
+
+    void SetParallelFixedUpdate(bool parallelFixedUpdate);
+    bool UsesParallelFixedUpdate() const;
+
     bool IsEnabled() const;
     int GetLayer() const;
     void SetLayer(int layer);
@@ -47,9 +69,19 @@ public:
 
     const std::set<GameObject *> &GetChildren();
 
-    void AddUpdateDelay(float *delay, bool useTimeScale = true);
+    /// @brief Ajoute un compte  rebours dcrment  chaque tick de la roue
+    /// Scene::GetTimers(), qui suit l'chelle de temps de la scne.
+    /// Cette mthode est conserve pour la compatibilit : une minuterie de l'objet
+    /// reste programme tant qu'il a des comptes  rebours. Prfrer les
+    /// TimerHandle, qui ne cotent rien tant qu'ils n'expirent pas.
+    /// @param delay le compte  rebours, mis  -1 quand il devient ngatif.
+    void AddUpdateDelay(float *delay);
     void RemoveUpdateDelay(float *delay);
 
+    /// @brief Ajoute un compte  rebours dcrment  chaque pas fixe,
+    /// par une minuterie de la roue Scene::GetFixedTimers().
+    /// Cette mthode est conserve pour la compatibilit, comme AddUpdateDelay().
+    /// @param delay le compte  rebours, mis  -1 quand il devient ngatif.
     void AddFixedUpdateDelay(float *delay);
     void RemoveFixedUpdateDelay(float *delay);
     Scene* m_scene;
@@ -59,12 +91,20 @@ protected:
 
 private:
     friend class ObjectManager;
+    friend class ObjectPoolBase;
+
+    /// @brief Rinsre dans la scne un objet recycl.
+    void Reactivate();
+
+    void ScheduleDelays(TimerWheel &timers, std::vector<float *> &delays, TimerHandle &handle);
+    void CancelDelays();
 
     void AddChild(GameObject *child);
     void RemoveChild(GameObject *child);
     void UpdateDepth();
 
     bool m_enabled;
+    bool m_parallelFixedUpdate;
     int m_layer;
     int m_depth;
     int m_objectID;
@@ -81,14 +121,25 @@ private:
     };
     Flag m_flags;
 
+    friend constexpr Flag operator |(const Flag selfValue, const Flag inValue);
+    friend constexpr Flag operator &(const Flag selfValue, const Flag inValue);
+    friend constexpr Flag operator ~(const Flag selfValue);
+
     void AddFlags(GameObject::Flag flags);
     void SubFlags(GameObject::Flag flags);
     bool TestFlag(GameObject::Flag flag) const;
 
+    /// @brief Pool ayant allou l'objet (nullptr si l'objet est allou avec new).
+    ObjectPoolBase *m_pool;
+
     GameObject *m_parent;
     std::set<GameObject *> m_children;
-    std::set<float *> m_fixedDelays;
-    std::map<float *, bool> m_delays;
+
+    /// @brief Comptes  rebours de compatibilit et minuteries qui les dcrmentent.
+    std::vector<float *> m_delays;
+    std::vector<float *> m_fixedDelays;
+    TimerHandle m_delayTimer;
+    TimerHandle m_fixedDelayTimer;
 };
 
 #include "Scene.h"
@@ -116,6 +167,16 @@ inline bool GameObject::IsEnabled() const
     return m_enabled;
 }
 
+inline void GameObject::SetParallelFixedUpdate(bool parallelFixedUpdate)
+{
+    m_parallelFixedUpdate = parallelFixedUpdate;
+}
+
+inline bool GameObject::UsesParallelFixedUpdate() const
+{
+    return m_parallelFixedUpdate;
+}
+
 inline int GameObject::GetLayer() const
 {
     return m_layer;
@@ -182,26 +243,6 @@ inline const std::set<GameObject *> &GameObject::GetChildren()
     return m_children;
 }
 
-inline void GameObject::AddUpdateDelay(float *delay, bool useTimeScale)
-{
-    m_delays.insert(std::make_pair(delay, useTimeScale));
-}
-
-inline void GameObject::RemoveUpdateDelay(float *delay)
-{
-    m_delays.erase(delay);
-}
-
-inline void GameObject::AddFixedUpdateDelay(float *delay)
-{
-    m_fixedDelays.insert(delay);
-}
-
-inline void GameObject::RemoveFixedUpdateDelay(float *delay)
-{
-    m_fixedDelays.erase(delay);
-}
-
 inline void GameObject::AddFlags(GameObject::Flag flags)
 {
     m_flags = m_flags | flags;
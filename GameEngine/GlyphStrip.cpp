@@ -0,0 +1,61 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "GlyphStrip.h"
+#include "Profiler.h"
+
+GlyphStrip::GlyphStrip(SDL_Renderer *renderer, TTF_Font *font) :
+    m_texture(nullptr), m_height(0), m_rects(), m_indices()
+{
+    PROFILE_SCOPE("GlyphStrip::Create");
+
+    const char *chars = GLYPH_STRIP_CHARS;
+    const SDL_Color white = { 255, 255, 255, 255 };
+    std::array<SDL_Surface *, GLYPH_COUNT> surfaces = { nullptr };
+    m_indices.fill(-1);
+
+    // Chaque glyphe est rendu seul, puis les glyphes sont placs cte  cte
+    int width = 0;
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        surfaces[i] = TTF_RenderGlyph_Blended(font, (Uint16)chars[i], white);
+        AssertNew(surfaces[i]);
+
+        m_rects[i] = SDL_Rect{ width, 0, surfaces[i]->w, surfaces[i]->h };
+        m_indices[(unsigned char)chars[i]] = (Sint8)i;
+        width += surfaces[i]->w;
+        m_height = std::max(m_height, surfaces[i]->h);
+    }
+
+    SDL_Surface *strip = SDL_CreateRGBSurfaceWithFormat(
+        0, width, m_height, 32, SDL_PIXELFORMAT_ARGB8888
+    );
+    AssertNew(strip);
+    SDL_FillRect(strip, NULL, SDL_MapRGBA(strip->format, 255, 255, 255, 0));
+
+    for (int i = 0; i < GLYPH_COUNT; i++)
+    {
+        // Copie sans mlange pour conserver la couverture des glyphes
+        SDL_Rect dstRect = m_rects[i];
+        SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(surfaces[i], NULL, strip, &dstRect);
+        SDL_FreeSurface(surfaces[i]);
+    }
+
+    m_texture = SDL_CreateTextureFromSurface(renderer, strip);
+    AssertNew(m_texture);
+    SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+
+    SDL_FreeSurface(strip);
+}
+
+GlyphStrip::~GlyphStrip()
+{
+    if (m_texture)
+    {
+        SDL_DestroyTexture(m_texture);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+/// @brief Caractres pr-rendus dans une GlyphStrip.
+#define GLYPH_STRIP_CHARS "0123456789:%+-./x "
+
+/// @brief Texture contenant les chiffres et quelques symboles d'une police,
+/// rendus une seule fois en blanc. Les compteurs de l'interface sont composs
+///  partir de ces glyphes et colors au dessin, sans rastrisation TTF.
+class GlyphStrip
+{
+public:
+    GlyphStrip(SDL_Renderer *renderer, TTF_Font *font);
+    GlyphStrip(GlyphStrip const&) = delete;
+    GlyphStrip& operator=(GlyphStrip const&) = delete;
+    ~GlyphStrip();
+
+    SDL_Texture *GetTexture();
+    int GetHeight() const;
+
+    /// @brief Renvoie l'indice d'un caractre dans la bande.
+    /// @param c le caractre.
+    /// @return L'indice du glyphe ou -1 s'il n'a pas t pr-rendu.
+    int GetGlyphIndex(char c) const;
+    const SDL_Rect &GetGlyphRect(int index) const;
+    int GetGlyphAdvance(int index) const;
+
+private:
+    static constexpr int GLYPH_COUNT = sizeof(GLYPH_STRIP_CHARS) - 1;
+
+    SDL_Texture *m_texture;
+    int m_height;
+    std::array<SDL_Rect, GLYPH_COUNT> m_rects;
+    std::array<Sint8, 128> m_indices;
+};
+
+inline SDL_Texture *GlyphStrip::GetTexture()
+{
+    return m_texture;
+}
+
+inline int GlyphStrip::GetHeight() const
+{
+    return m_height;
+}
+
+inline int GlyphStrip::GetGlyphIndex(char c) const
+{
+    const unsigned char u = (unsigned char)c;
+    return (u < m_indices.size()) ? m_indices[u] : -1;
+}
+
+inline const SDL_Rect &GlyphStrip::GetGlyphRect(int index) const
+{
+    assert(0 <= index && index < GLYPH_COUNT);
+    return m_rects[index];
+}
+
+inline int GlyphStrip::GetGlyphAdvance(int index) const
+{
+    return (index >= 0) ? m_rects[index].w : 0;
+}
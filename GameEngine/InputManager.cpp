@@ -5,6 +5,7 @@
 */
 
 #include "InputManager.h"
+#include "Common.h"
 #include "Utils.h"
 
 InputManager::InputManager() :
@@ -63,6 +64,12 @@ void InputManager::ProcessEvents()
             RemoveGameController(evt.cdevice.which);
             break;
 
+        case SDL_RENDER_TARGETS_RESET:
+        case SDL_RENDER_DEVICE_RESET:
+            // Les images conserves dans des textures cibles sont perdues
+            Game_OnRenderReset();
+            break;
+
         case SDL_CONTROLLERAXISMOTION:
         case SDL_CONTROLLERBUTTONDOWN:
         case SDL_CONTROLLERBUTTONUP:
@@ -0,0 +1,166 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "JobSystem.h"
+
+#define JOB_RANGES_PER_THREAD 4
+
+void JobSystem::JobQueue::Push(const JobRange &range)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_ranges.push_back(range);
+}
+
+bool JobSystem::JobQueue::PopBack(JobRange &range)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_ranges.empty()) return false;
+
+    range = m_ranges.back();
+    m_ranges.pop_back();
+    return true;
+}
+
+bool JobSystem::JobQueue::StealFront(JobRange &range)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_ranges.empty()) return false;
+
+    range = m_ranges.front();
+    m_ranges.pop_front();
+    return true;
+}
+
+JobSystem::JobSystem(int workerCount) :
+    m_workerCount(workerCount), m_threads(), m_queues(), m_queuedCount(0),
+    m_sleepMutex(), m_sleepCondition(), m_quit(false)
+{
+    if (m_workerCount < 0)
+    {
+        // Garde un coeur pour le thread principal et un pour le thread appelant
+        int coreCount = (int)std::thread::hardware_concurrency();
+        m_workerCount = std::max(coreCount - 2, 1);
+    }
+
+    for (int i = 0; i < m_workerCount + 1; i++)
+    {
+        m_queues.push_back(new JobQueue());
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_quit = true;
+    }
+    m_sleepCondition.notify_all();
+
+    for (std::thread &thread : m_threads)
+    {
+        thread.join();
+    }
+    for (JobQueue *queue : m_queues)
+    {
+        delete queue;
+    }
+}
+
+void JobSystem::StartWorkers()
+{
+    for (int i = 0; i < m_workerCount; i++)
+    {
+        m_threads.push_back(std::thread(&JobSystem::WorkerLoop, this, i));
+    }
+}
+
+void JobSystem::ParallelFor(int count, const std::function<void(int)> &job)
+{
+    if (count <= 0) return;
+
+    if (m_workerCount == 0 || count == 1)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            job(i);
+        }
+        return;
+    }
+
+    if (m_threads.empty())
+    {
+        StartWorkers();
+    }
+
+    // Dcoupe les indices en intervalles rpartis dans les files
+    const int queueCount = (int)m_queues.size();
+    const int rangeCount = std::min(count, JOB_RANGES_PER_THREAD * queueCount);
+    std::atomic<int> pending(rangeCount);
+
+    for (int i = 0; i < rangeCount; i++)
+    {
+        JobRange range;
+        range.job = &job;
+        range.pending = &pending;
+        range.begin = (int)((int64_t)count * i / rangeCount);
+        range.end = (int)((int64_t)count * (i + 1) / rangeCount);
+        m_queues[i % queueCount]->Push(range);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_queuedCount += rangeCount;
+    }
+    m_sleepCondition.notify_all();
+
+    // Le thread appelant participe jusqu' la fin de tous les jobs
+    const int callerIndex = queueCount - 1;
+    while (pending.load() > 0)
+    {
+        if (TryRunJob(callerIndex) == false)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::TryRunJob(int queueIndex)
+{
+    JobRange range;
+    bool found = m_queues[queueIndex]->PopBack(range);
+
+    // Vole un job dans les autres files
+    const int queueCount = (int)m_queues.size();
+    for (int i = 1; (found == false) && (i < queueCount); i++)
+    {
+        found = m_queues[(queueIndex + i) % queueCount]->StealFront(range);
+    }
+    if (found == false) return false;
+
+    m_queuedCount--;
+
+    for (int i = range.begin; i < range.end; i++)
+    {
+        (*range.job)(i);
+    }
+    range.pending->fetch_sub(1);
+
+    return true;
+}
+
+void JobSystem::WorkerLoop(int queueIndex)
+{
+    while (true)
+    {
+        if (TryRunJob(queueIndex)) continue;
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepCondition.wait(lock, [this] {
+            return m_quit || m_queuedCount.load() > 0;
+        });
+        if (m_quit) return;
+    }
+}
@@ -0,0 +1,84 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// @brief Systme de jobs avec vol de travail.
+/// Chaque thread possde sa propre file de jobs et vole les jobs
+/// des autres files lorsque la sienne est vide.
+class JobSystem
+{
+public:
+    /// @brief Construit le systme de jobs.
+    /// Les threads ne sont crs qu'au premier appel  ParallelFor().
+    /// @param workerCount nombre de threads secondaires
+    /// (-1 pour l'adapter au nombre de coeurs).
+    JobSystem(int workerCount = -1);
+    JobSystem(JobSystem const&) = delete;
+    JobSystem& operator=(JobSystem const&) = delete;
+    ~JobSystem();
+
+    /// @brief Excute job(i) pour tout i dans [0, count[ en parallle.
+    /// Le thread appelant participe  l'excution et attend la fin de tous
+    /// les jobs. Cette mthode ne doit pas tre appele depuis un job.
+    /// @param count nombre d'indices.
+    /// @param job la fonction  excuter pour chaque indice.
+    void ParallelFor(int count, const std::function<void(int)> &job);
+
+    int GetWorkerCount() const;
+
+private:
+    struct JobRange
+    {
+        const std::function<void(int)> *job;
+        std::atomic<int> *pending;
+        int begin;
+        int end;
+    };
+
+    class JobQueue
+    {
+    public:
+        void Push(const JobRange &range);
+        bool PopBack(JobRange &range);
+        bool StealFront(JobRange &range);
+
+    private:
+        std::mutex m_mutex;
+        std::deque<JobRange> m_ranges;
+    };
+
+    void StartWorkers();
+    void WorkerLoop(int queueIndex);
+    bool TryRunJob(int queueIndex);
+
+    int m_workerCount;
+    std::vector<std::thread> m_threads;
+
+    /// @brief Files de jobs, la dernire est celle du thread appelant.
+    std::vector<JobQueue *> m_queues;
+
+    /// @brief Nombre de jobs en attente dans les files.
+    std::atomic<int> m_queuedCount;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCondition;
+    bool m_quit;
+};
+
+inline int JobSystem::GetWorkerCount() const
+{
+    return m_workerCount;
+}
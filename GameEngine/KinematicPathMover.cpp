@@ -0,0 +1,184 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "KinematicPathMover.h"
+
+namespace
+{
+    /// @brief Application affine donnant l'tat (position, vitesse) d'un axe
+    /// en fin de segment  partir de l'tat en dbut de segment.
+    struct AxisMap
+    {
+        float m[2][2];
+        float b[2];
+    };
+
+    void GetSegmentMap(float omega, float duration, float target, AxisMap &map)
+    {
+        const float e = expf(-omega * duration);
+        const float od = omega * duration;
+
+        map.m[0][0] = e * (1.f + od);
+        map.m[0][1] = e * duration;
+        map.m[1][0] = -e * omega * od;
+        map.m[1][1] = e * (1.f - od);
+
+        map.b[0] = target * (1.f - map.m[0][0]);
+        map.b[1] = -target * map.m[1][0];
+    }
+
+    /// @brief Calcule l'application compose "second o first".
+    void Compose(const AxisMap &second, const AxisMap &first, AxisMap &result)
+    {
+        AxisMap tmp;
+        for (int i = 0; i < 2; i++)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                tmp.m[i][j] = second.m[i][0] * first.m[0][j] + second.m[i][1] * first.m[1][j];
+            }
+            tmp.b[i] = second.m[i][0] * first.b[0] + second.m[i][1] * first.b[1] + second.b[i];
+        }
+        result = tmp;
+    }
+
+    /// @brief Rsout s = map(s). Renvoie false si l'application n'a pas
+    /// de point fixe unique (trajet sans amortissement).
+    bool GetFixedPoint(const AxisMap &map, float &position, float &velocity)
+    {
+        const float a = 1.f - map.m[0][0], b = -map.m[0][1];
+        const float c = -map.m[1][0], d = 1.f - map.m[1][1];
+        const float det = a * d - b * c;
+        if (fabsf(det) < 1e-6f) return false;
+
+        position = (d * map.b[0] - b * map.b[1]) / det;
+        velocity = (a * map.b[1] - c * map.b[0]) / det;
+        return true;
+    }
+}
+
+KinematicPathMover::KinematicPathMover() :
+    m_firstLoop(), m_loop(), m_startTimes(),
+    m_loopDuration(0.f), m_startPosition(b2Vec2_zero)
+{
+}
+
+void KinematicPathMover::SetPath(const b2Vec2 &startPosition, const PathKey *keys, int keyCount)
+{
+    m_firstLoop.clear();
+    m_loop.clear();
+    m_startTimes.clear();
+    m_loopDuration = 0.f;
+    m_startPosition = startPosition;
+
+    if (keyCount <= 0) return;
+
+    for (int i = 0; i < keyCount; i++)
+    {
+        m_startTimes.push_back(m_loopDuration);
+        m_loopDuration += fmaxf(0.f, keys[i].duration);
+    }
+    if (m_loopDuration <= 0.f)
+    {
+        m_startTimes.clear();
+        return;
+    }
+
+    // Premier tour, depuis la position de dpart  l'arrt
+    BuildLoop(keys, keyCount, startPosition, b2Vec2_zero, m_firstLoop);
+
+    // Rgime priodique : l'tat au dbut d'un tour est le point fixe
+    // de l'application qui donne l'tat  la fin du tour
+    AxisMap mapX = { { { 1.f, 0.f }, { 0.f, 1.f } }, { 0.f, 0.f } };
+    AxisMap mapY = mapX;
+    for (int i = 0; i < keyCount; i++)
+    {
+        const float omega = 2.f / fmaxf(0.0001f, keys[i].smoothTime);
+        const float duration = fmaxf(0.f, keys[i].duration);
+
+        AxisMap segmentMap;
+        GetSegmentMap(omega, duration, keys[i].position.x, segmentMap);
+        Compose(segmentMap, mapX, mapX);
+        GetSegmentMap(omega, duration, keys[i].position.y, segmentMap);
+        Compose(segmentMap, mapY, mapY);
+    }
+
+    b2Vec2 position, velocity;
+    if (GetFixedPoint(mapX, position.x, velocity.x) &&
+        GetFixedPoint(mapY, position.y, velocity.y))
+    {
+        BuildLoop(keys, keyCount, position, velocity, m_loop);
+    }
+    else
+    {
+        m_loop = m_firstLoop;
+    }
+}
+
+void KinematicPathMover::BuildLoop(
+    const PathKey *keys, int keyCount, b2Vec2 position, b2Vec2 velocity,
+    std::vector<Segment> &segments) const
+{
+    segments.resize(keyCount);
+    for (int i = 0; i < keyCount; i++)
+    {
+        Segment &segment = segments[i];
+        segment.omega = 2.f / fmaxf(0.0001f, keys[i].smoothTime);
+        segment.target = keys[i].position;
+        segment.c1 = position - segment.target;
+        segment.c2 = velocity + segment.omega * segment.c1;
+
+        // tat en fin de segment
+        const float duration = fmaxf(0.f, keys[i].duration);
+        const float e = expf(-segment.omega * duration);
+        const b2Vec2 u = segment.c1 + duration * segment.c2;
+        position = segment.target + e * u;
+        velocity = e * (segment.c2 - segment.omega * u);
+    }
+}
+
+const KinematicPathMover::Segment &KinematicPathMover::FindSegment(float time, float &localTime) const
+{
+    const std::vector<Segment> *segments = &m_firstLoop;
+    if (time >= m_loopDuration)
+    {
+        segments = &m_loop;
+        time = fmodf(time - m_loopDuration, m_loopDuration);
+    }
+
+    auto it = std::upper_bound(m_startTimes.begin(), m_startTimes.end(), time);
+    int index = std::max(0, (int)(it - m_startTimes.begin()) - 1);
+
+    localTime = time - m_startTimes[index];
+    return (*segments)[index];
+}
+
+b2Vec2 KinematicPathMover::GetPosition(float time) const
+{
+    if (IsEmpty() || time <= 0.f) return m_startPosition;
+
+    float t = 0.f;
+    const Segment &segment = FindSegment(time, t);
+    return segment.target + expf(-segment.omega * t) * (segment.c1 + t * segment.c2);
+}
+
+b2Vec2 KinematicPathMover::GetVelocity(float time) const
+{
+    if (IsEmpty() || time <= 0.f) return b2Vec2_zero;
+
+    float t = 0.f;
+    const Segment &segment = FindSegment(time, t);
+    const b2Vec2 u = segment.c1 + t * segment.c2;
+    return expf(-segment.omega * t) * (segment.c2 - segment.omega * u);
+}
+
+void KinematicPathMover::Step(b2Body *body, float time, float timeStep) const
+{
+    if (IsEmpty() || timeStep <= 0.f) return;
+
+    b2Vec2 target = GetPosition(time + timeStep);
+    body->SetLinearVelocity((1.f / timeStep) * (target - body->GetPosition()));
+}
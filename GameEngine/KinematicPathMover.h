@@ -0,0 +1,90 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+/// @brief tape d'un trajet. Le corps se dirige vers la position cible
+/// comme un ressort  amortissement critique (voir Math::SmoothDamp())
+/// puis passe  l'tape suivante aprs la dure indique.
+struct PathKey
+{
+    b2Vec2 position;
+    float smoothTime;
+    float duration;
+};
+
+/// @brief Dplace un corps cinmatique le long d'un trajet parcouru en boucle.
+/// Le trajet est prcalcul sous forme de segments dont la position est donne
+/// par une formule close : il est valu directement  partir du temps,
+/// sans tat mis  jour  chaque pas. Deux corps avec le mme trajet
+/// et le mme instant de dpart sont donc toujours  la mme position.
+class KinematicPathMover
+{
+public:
+    KinematicPathMover();
+
+    /// @brief Prcalcule le trajet.
+    /// Le premier tour part de la position de dpart,  l'arrt.
+    /// Les tours suivants utilisent le rgime priodique du trajet,
+    /// dont l'tat initial est obtenu en rsolvant un systme 2x2.
+    /// @param startPosition la position du corps au dbut du trajet.
+    /// @param keys les tapes du trajet.
+    /// @param keyCount le nombre d'tapes.
+    void SetPath(const b2Vec2 &startPosition, const PathKey *keys, int keyCount);
+
+    bool IsEmpty() const;
+    float GetLoopDuration() const;
+
+    /// @brief Renvoie la position sur le trajet.
+    /// @param time le temps coul depuis le dbut du trajet (en secondes).
+    b2Vec2 GetPosition(float time) const;
+
+    /// @brief Renvoie la vitesse sur le trajet.
+    /// @param time le temps coul depuis le dbut du trajet (en secondes).
+    b2Vec2 GetVelocity(float time) const;
+
+    /// @brief Donne au corps la vitesse qui l'amne sur le trajet au pas suivant.
+    /// L'cart ventuel du corps avec le trajet est ainsi corrig en un pas.
+    /// @param body le corps cinmatique  dplacer.
+    /// @param time le temps coul depuis le dbut du trajet (en secondes).
+    /// @param timeStep le pas de temps fixe.
+    void Step(b2Body *body, float time, float timeStep) const;
+
+private:
+    /// @brief Segment d'quation x(t) = target + (c1 + c2 * t) * exp(-omega * t).
+    struct Segment
+    {
+        b2Vec2 target;
+        b2Vec2 c1;
+        b2Vec2 c2;
+        float omega;
+    };
+
+    std::vector<Segment> m_firstLoop;
+    std::vector<Segment> m_loop;
+
+    /// @brief Instants de dbut des segments dans un tour.
+    std::vector<float> m_startTimes;
+    float m_loopDuration;
+    b2Vec2 m_startPosition;
+
+    const Segment &FindSegment(float time, float &localTime) const;
+    void BuildLoop(
+        const PathKey *keys, int keyCount, b2Vec2 position, b2Vec2 velocity,
+        std::vector<Segment> &segments) const;
+};
+
+inline bool KinematicPathMover::IsEmpty() const
+{
+    return m_loop.empty();
+}
+
+inline float KinematicPathMover::GetLoopDuration() const
+{
+    return m_loopDuration;
+}
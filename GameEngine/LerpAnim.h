@@ -9,36 +9,60 @@
 #include "Settings.h"
 #include "Animation.h"
 
-template <class T>
+/// @brief Animation interpolant linairement deux valeurs.
+/// @tparam Easing courbe d'acclration connue  la compilation (EaseInOut...),
+/// dont l'appel est dvelopp en ligne. Dans ce cas, SetEasing() est sans effet.
+/// Par dfaut, EaseDynamic applique la courbe dfinie par SetEasing().
+template <class T, class Easing = EaseDynamic>
 class LerpAnim : public Animation
 {
 public:
-    LerpAnim(const std::string &name, T value0, T value1);
+    LerpAnim(AnimationSystem *system, const std::string &name, T value0, T value1);
 
     void SetValues(T value0, T value1);
     T GetValue() const;
 
 protected:
     T m_values[2];
+
+private:
+    float GetEasedProgression(EaseDynamic) const;
+    template <class StaticEasing>
+    float GetEasedProgression(StaticEasing easing) const;
 };
 
-template<class T>
-inline LerpAnim<T>::LerpAnim(const std::string &name, T value0, T value1) :
-    Animation(name), m_values{ value0, value1 }
+template<class T, class Easing>
+inline LerpAnim<T, Easing>::LerpAnim(
+    AnimationSystem *system, const std::string &name, T value0, T value1) :
+    Animation(system, name), m_values{ value0, value1 }
 {
 }
 
-template<class T>
-inline void LerpAnim<T>::SetValues(T value0, T value1)
+template<class T, class Easing>
+inline void LerpAnim<T, Easing>::SetValues(T value0, T value1)
 {
     m_values[0] = value0;
     m_values[1] = value1;
 }
 
-template<class T>
-inline T LerpAnim<T>::GetValue() const
+template<class T, class Easing>
+inline T LerpAnim<T, Easing>::GetValue() const
 {
-    float p = GetProgression();
-    p = fmaxf(0.f, fminf(p, 1.f));
+    const float p = GetEasedProgression(Easing());
     return (1.f - p) * m_values[0] + p * m_values[1];
 }
+
+template<class T, class Easing>
+inline float LerpAnim<T, Easing>::GetEasedProgression(EaseDynamic) const
+{
+    const float p = GetProgression();
+    return fmaxf(0.f, fminf(p, 1.f));
+}
+
+template<class T, class Easing>
+template<class StaticEasing>
+inline float LerpAnim<T, Easing>::GetEasedProgression(StaticEasing easing) const
+{
+    // Les courbes prdfinies restent entre 0.f et 1.f
+    return easing(GetCycleRatio());
+}
@@ -8,11 +8,14 @@
 #include "GameObject.h"
 #include "GameBody.h"
 #include "UIObject.h"
+#include "ObjectPool.h"
+#include "Profiler.h"
 
 //#define DEBUG_OBJECT_ON_DELETE
 
 ObjectManager::ObjectManager() :
-    m_objects(), m_toProcess(), m_visibleObjects(), m_nextID(0)
+    m_objects(), m_toProcess(), m_visibleObjects(), m_nextID(0),
+    m_frameArena(nullptr)
 {
 }
 
@@ -76,7 +79,7 @@ void ObjectManager::DeleteObjects()
     ProcessObjects();
     for (GameObject *gameObject : m_objects)
     {
-        delete gameObject;
+        DestroyObject(gameObject);
     }
     m_objects.clear();
     m_toProcess.clear();
@@ -89,11 +92,6 @@ bool ObjectManager::Contains(GameObject *object) const
     return m_objects.find(object) != m_objects.end();
 }
 
-void ObjectManager::ClearVisibleObjects()
-{
-    m_visibleObjects.clear();
-}
-
 
 bool CompareDepth(const GameObject *objectA, const GameObject *objectB)
 {
@@ -106,8 +104,16 @@ bool CompareDepth(const GameObject *objectA, const GameObject *objectB)
 
 void ObjectManager::ProcessObjects()
 {
-    std::set<GameObject *> toDelete;
-    std::vector<GameObject *> toProcessCopy(m_toProcess.begin(), m_toProcess.end());
+    PROFILE_SCOPE("ObjectManager::ProcessObjects");
+
+    assert(m_frameArena != nullptr);
+
+    // Les tableaux temporaires sont rendus  l'arne  la fin de la mthode
+    FrameArenaScope arenaScope(*m_frameArena);
+    ArenaVector<GameObject *> toDelete(m_frameArena);
+    ArenaVector<GameObject *> toProcessCopy(
+        m_toProcess.begin(), m_toProcess.end(), m_frameArena
+    );
 
     // Remet  zro le conteneur
     m_toProcess.clear();
@@ -151,7 +157,7 @@ void ObjectManager::ProcessObjects()
         // DELETE
         if (gameObject->TestFlag(GameObject::Flag::TO_DELETE))
         {
-            toDelete.insert(gameObject);
+            toDelete.push_back(gameObject);
         }
 
         // DEBUG
@@ -163,6 +169,13 @@ void ObjectManager::ProcessObjects()
     #endif
     }
 
+    if (toDelete.empty() == false)
+    {
+        PROFILE_MARKER("ObjectManager::DeleteBurst", (int)toDelete.size());
+    }
+
+    PROFILE_SCOPE("ObjectManager::DeleteObjects");
+
     for (auto gameObject : toDelete)
     {
         gameObject->OnDelete();
@@ -171,6 +184,7 @@ void ObjectManager::ProcessObjects()
     {
         gameObject->SetParent(nullptr);
     }
+
     for (auto &gameObject : toDelete)
     {
         // On dtruit toutes les rfrences de l'objet
@@ -181,12 +195,25 @@ void ObjectManager::ProcessObjects()
     #ifdef DEBUG_OBJECT_ON_DELETE
         gameObject->AddFlags(GameObject::Flag::DEBUG_DELETED);
     #else
-        delete gameObject;
+        DestroyObject(gameObject);
     #endif
     }
     m_visibleObjects.clear();
 }
 
+void ObjectManager::DestroyObject(GameObject *gameObject)
+{
+    // Les objets allous par un pool lui sont rendus
+    if (gameObject->m_pool)
+    {
+        gameObject->m_pool->Release(gameObject);
+    }
+    else
+    {
+        delete gameObject;
+    }
+}
+
 void ObjectManager::PrintObjects() const
 {
     // Trie les objets hierarchiquement
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Settings.h"
+#include "FrameArena.h"
 
 class GameObject;
 
@@ -26,8 +27,13 @@ public:
     void AddVisibleBodies(b2World &world, const b2AABB &worldView);
     void DeleteObjects();
     bool Contains(GameObject *object) const;
+    int GetObjectCount() const;
+    int GetVisibleCount() const;
 
-    void ClearVisibleObjects();
+    /// @brief Définit l'arène utilisée pour les tableaux temporaires
+    /// de ProcessObjects().
+    /// @param arena l'arène de la frame, vidée par la scène.
+    void SetFrameArena(FrameArena *arena);
          
     void ProcessObjects();
     void ProcessVisibleObjects();
@@ -49,11 +55,19 @@ private:
     std::set<GameObject *> m_visibleSet;
     std::set<GameObject *> m_toProcess;
 
+    FrameArena *m_frameArena;
+
 
     void PrintObjectsRec(GameObject *gameObject) const;
+    void DestroyObject(GameObject *gameObject);
     void ValidateWorldView(const b2AABB &worldView) const;
 };
 
+inline void ObjectManager::SetFrameArena(FrameArena *arena)
+{
+    m_frameArena = arena;
+}
+
 inline std::set<GameObject*>::iterator ObjectManager::begin()
 {
     return m_objects.begin();
@@ -74,6 +88,16 @@ inline const std::vector<GameObject *>::iterator ObjectManager::visibleObjectsEn
     return m_visibleObjects.end();
 }
 
+inline int ObjectManager::GetObjectCount() const
+{
+    return (int)m_objects.size();
+}
+
+inline int ObjectManager::GetVisibleCount() const
+{
+    return (int)m_visibleObjects.size();
+}
+
 inline bool ObjectManager::IsVisible(GameObject *object) const
 {
     auto it = m_visibleSet.find(object);
@@ -0,0 +1,18 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "ObjectPool.h"
+#include "GameObject.h"
+
+void ObjectPoolBase::SetPool(GameObject *gameObject, ObjectPoolBase *pool)
+{
+    gameObject->m_pool = pool;
+}
+
+void ObjectPoolBase::Reactivate(GameObject *gameObject)
+{
+    gameObject->Reactivate();
+}
@@ -0,0 +1,197 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#define OBJECT_POOL_SLAB_SIZE 32
+
+class Scene;
+class GameObject;
+
+/// @brief Interface des pools d'objets, utilise par l'ObjectManager
+/// pour rendre un objet supprim  son pool plutt que de le dtruire.
+class ObjectPoolBase
+{
+public:
+    ObjectPoolBase() {}
+    ObjectPoolBase(ObjectPoolBase const&) = delete;
+    ObjectPoolBase& operator=(ObjectPoolBase const&) = delete;
+    virtual ~ObjectPoolBase() {}
+
+    /// @brief Rend un objet supprim au pool.
+    /// @param gameObject l'objet, allou par ce pool.
+    virtual void Release(GameObject *gameObject) = 0;
+
+protected:
+    static void SetPool(GameObject *gameObject, ObjectPoolBase *pool);
+    static void Reactivate(GameObject *gameObject);
+};
+
+/// @brief Allocateur par blocs d'objets d'un mme type.
+/// Les objets sont construits dans des blocs de OBJECT_POOL_SLAB_SIZE
+/// emplacements contigus, rutiliss aprs leur suppression.
+/// Avec le recyclage, un objet supprim n'est pas dtruit : il est
+/// rinsr dans la scne par Create() qui appelle T::Reset()
+///  la place du constructeur.
+/// @tparam T le type des objets, dont le constructeur prend la scne
+/// en premier paramtre et dont la mthode Reset() prend les paramtres suivants.
+template <class T>
+class ObjectPool : public ObjectPoolBase
+{
+public:
+    ObjectPool(Scene *scene);
+    virtual ~ObjectPool();
+
+    /// @brief Cre un objet dans le pool, ou rutilise un objet recycl.
+    /// @param args les paramtres du constructeur (aprs la scne) ou de T::Reset().
+    /// @return L'objet, ajout  la scne.
+    template <typename... Args>
+    T *Create(Args&&... args);
+
+    virtual void Release(GameObject *gameObject) override;
+
+    /// @brief Active le recyclage des objets supprims.
+    /// @param recycling boolen indiquant si les objets sont recycls.
+    void SetRecycling(bool recycling);
+    bool IsRecycling() const;
+
+    /// @brief Renvoie le nombre d'objets construits dans le pool,
+    /// qu'ils soient prsents dans la scne ou recycls.
+    int GetObjectCount() const;
+    int GetCapacity() const;
+
+    /// @brief Renvoie le nombre d'objets recycls, en attente de rutilisation.
+    int GetRecycledCount() const;
+
+private:
+    struct Slot
+    {
+        alignas(T) unsigned char data[sizeof(T)];
+    };
+
+    Slot *AllocateSlot();
+
+    Scene *m_scene;
+    bool m_recycling;
+
+    std::vector<Slot *> m_slabs;
+    std::vector<Slot *> m_freeSlots;
+    std::vector<T *> m_recycled;
+};
+
+template <class T>
+inline ObjectPool<T>::ObjectPool(Scene *scene) :
+    ObjectPoolBase(), m_scene(scene), m_recycling(false),
+    m_slabs(), m_freeSlots(), m_recycled()
+{
+}
+
+template <class T>
+inline ObjectPool<T>::~ObjectPool()
+{
+    for (T *object : m_recycled)
+    {
+        object->~T();
+        m_freeSlots.push_back(reinterpret_cast<Slot *>(object));
+    }
+    m_recycled.clear();
+
+    // Les objets doivent tre supprims par la scne avant le pool
+    assert(m_freeSlots.size() == m_slabs.size() * OBJECT_POOL_SLAB_SIZE);
+
+    for (Slot *slab : m_slabs)
+    {
+        delete[] slab;
+    }
+}
+
+template <class T>
+template <typename... Args>
+inline T *ObjectPool<T>::Create(Args&&... args)
+{
+    if (m_recycled.empty() == false)
+    {
+        T *object = m_recycled.back();
+        m_recycled.pop_back();
+
+        Reactivate(object);
+        object->Reset(std::forward<Args>(args)...);
+        return object;
+    }
+
+    Slot *slot = AllocateSlot();
+    T *object = new (slot) T(m_scene, std::forward<Args>(args)...);
+    SetPool(object, this);
+    return object;
+}
+
+template <class T>
+inline void ObjectPool<T>::Release(GameObject *gameObject)
+{
+    T *object = static_cast<T *>(gameObject);
+    if (m_recycling)
+    {
+        object->OnRecycle();
+        m_recycled.push_back(object);
+    }
+    else
+    {
+        object->~T();
+        m_freeSlots.push_back(reinterpret_cast<Slot *>(object));
+    }
+}
+
+template <class T>
+inline typename ObjectPool<T>::Slot *ObjectPool<T>::AllocateSlot()
+{
+    if (m_freeSlots.empty())
+    {
+        Slot *slab = new Slot[OBJECT_POOL_SLAB_SIZE];
+        AssertNew(slab);
+        m_slabs.push_back(slab);
+
+        for (int i = OBJECT_POOL_SLAB_SIZE - 1; i >= 0; i--)
+        {
+            m_freeSlots.push_back(slab + i);
+        }
+    }
+
+    Slot *slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    return slot;
+}
+
+template <class T>
+inline void ObjectPool<T>::SetRecycling(bool recycling)
+{
+    m_recycling = recycling;
+}
+
+template <class T>
+inline bool ObjectPool<T>::IsRecycling() const
+{
+    return m_recycling;
+}
+
+template <class T>
+inline int ObjectPool<T>::GetObjectCount() const
+{
+    return GetCapacity() - (int)m_freeSlots.size();
+}
+
+template <class T>
+inline int ObjectPool<T>::GetRecycledCount() const
+{
+    return (int)m_recycled.size();
+}
+
+template <class T>
+inline int ObjectPool<T>::GetCapacity() const
+{
+    return (int)m_slabs.size() * OBJECT_POOL_SLAB_SIZE;
+}
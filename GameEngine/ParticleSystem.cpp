@@ -8,8 +8,11 @@
 #include "Utils.h"
 #include "Camera.h"
 
-Particle::Particle(SpriteGroup *spriteGroup, const b2Vec2 &position, float pixPerUnit) :
-    m_spriteAnim("ParticleAnim", spriteGroup), m_alphaAnim(nullptr), m_scaleAnim(nullptr),
+Particle::Particle(
+    AnimationSystem *system, SpriteGroup *spriteGroup,
+    const b2Vec2 &position, float pixPerUnit) :
+    m_system(system), m_spriteAnim(system, "ParticleAnim", spriteGroup),
+    m_alphaAnim(nullptr), m_scaleAnim(nullptr),
     m_angle(0.f), m_angularVelocity(0.f), m_opacity(1.f), m_startSize(1.f),
     m_lifetime(0.f), m_remainingLifetime(1.f),
     m_position(position), m_velocity(b2Vec2_zero),
@@ -32,7 +35,7 @@ bool Particle::Update(float dt)
         m_started = true;
     }
 
-    m_spriteAnim.Update(dt);
+    // Les animations sont avances par l'AnimationSystem de la scne
     if (m_spriteAnim.IsDelayed()) return true;
 
     m_remainingLifetime -= dt;
@@ -46,9 +49,6 @@ bool Particle::Update(float dt)
     m_position += dt * m_velocity;
 
     m_angle += dt * m_angularVelocity;
-    
-    if (m_scaleAnim) m_scaleAnim->Update(dt);
-    if (m_alphaAnim) m_alphaAnim->Update(dt);
 
     return true;
 }
@@ -88,7 +88,7 @@ void Particle::Render(SDL_Renderer *renderer, Camera *camera)
 LerpAnim<float> *Particle::CreateAlphaAnimation(float value0, float value1)
 {
     if (m_alphaAnim) delete m_alphaAnim;
-    m_alphaAnim = new LerpAnim<float>("AlphaAnim", value0, value1);
+    m_alphaAnim = new LerpAnim<float>(m_system, "AlphaAnim", value0, value1);
     m_alphaAnim->SetCycleTime(m_lifetime);
     m_alphaAnim->SetCycleCount(1);
     m_alphaAnim->Play();
@@ -98,7 +98,7 @@ LerpAnim<float> *Particle::CreateAlphaAnimation(float value0, float value1)
 LerpAnim<float> *Particle::CreateScaleAnimation(float value0, float value1)
 {
     if (m_scaleAnim) delete m_scaleAnim;
-    m_scaleAnim = new LerpAnim<float>("ScaleAnim", value0, value1);
+    m_scaleAnim = new LerpAnim<float>(m_system, "ScaleAnim", value0, value1);
     m_scaleAnim->SetCycleTime(m_lifetime);
     m_scaleAnim->SetCycleCount(1);
     m_scaleAnim->Play();
@@ -122,7 +122,9 @@ ParticleSystem::~ParticleSystem()
 
 Particle *ParticleSystem::EmitParticle(SpriteGroup *spriteGroup, const b2Vec2 &position, float pixPerUnit)
 {
-    Particle *particle = new Particle(spriteGroup, position, pixPerUnit);
+    Particle *particle = new Particle(
+        m_scene->GetAnimationSystem(), spriteGroup, position, pixPerUnit
+    );
     m_particles.insert(particle);
     return particle;
 }
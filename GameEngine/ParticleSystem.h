@@ -41,7 +41,9 @@ inline int ParticleSystem::GetParticleCount() const
 class Particle
 {
 public:
-    Particle(SpriteGroup *spriteGroup, const b2Vec2 &position, float pixPerUnit);
+    Particle(
+        AnimationSystem *system, SpriteGroup *spriteGroup,
+        const b2Vec2 &position, float pixPerUnit);
     virtual ~Particle();
 
     virtual bool Update(float dt);
@@ -76,6 +78,7 @@ protected:
     float m_pixPerUnit;
     bool m_started;
 
+    AnimationSystem *m_system;
     SpriteAnim m_spriteAnim;
     LerpAnim<float> *m_scaleAnim;
     LerpAnim<float> *m_alphaAnim;
@@ -0,0 +1,203 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "Profiler.h"
+#include "ProfilerTrace.h"
+
+#define PROFILER_SMOOTHING 0.05f
+
+std::atomic<bool> Profiler::s_enabled(true);
+std::mutex Profiler::s_mutex;
+std::vector<Profiler::ThreadBuffer *> Profiler::s_buffers;
+int Profiler::s_nextThreadID = 0;
+std::vector<ProfilerZoneStats> Profiler::s_zones;
+Uint64 Profiler::s_frameBegin = 0;
+float Profiler::s_frameMS = 0.f;
+ProfilerTrace *Profiler::s_trace = nullptr;
+
+Profiler::ThreadBuffer::ThreadBuffer(int threadID) :
+    events(), writeIndex(0), readIndex(0), threadID(threadID), released(false)
+{
+}
+
+Profiler::ThreadBufferHandle::ThreadBufferHandle() :
+    buffer(nullptr)
+{
+}
+
+Profiler::ThreadBufferHandle::~ThreadBufferHandle()
+{
+    // Le tampon sera rutilis par un autre thread une fois vid
+    if (buffer) buffer->released = true;
+}
+
+Profiler::ThreadBuffer *Profiler::GetThreadBuffer()
+{
+    static thread_local ThreadBufferHandle handle;
+    if (handle.buffer) return handle.buffer;
+
+    std::unique_lock<std::mutex> lock(s_mutex);
+    for (ThreadBuffer *buffer : s_buffers)
+    {
+        if (buffer->released &&
+            buffer->readIndex == buffer->writeIndex.load(std::memory_order_acquire))
+        {
+            buffer->released = false;
+            buffer->threadID = s_nextThreadID++;
+            handle.buffer = buffer;
+            return buffer;
+        }
+    }
+
+    ThreadBuffer *buffer = new ThreadBuffer(s_nextThreadID++);
+    AssertNew(buffer);
+    s_buffers.push_back(buffer);
+    handle.buffer = buffer;
+    return buffer;
+}
+
+void Profiler::PushEvent(const char *name, Uint64 begin, Uint64 end)
+{
+    PushEvent(ProfilerEvent{ name, begin, end, 0, ProfilerEventType::ZONE, 0 });
+}
+
+void Profiler::PushMarker(const char *name, int value)
+{
+    if (IsEnabled() == false) return;
+
+    const Uint64 counter = GetCounter();
+    PushEvent(ProfilerEvent{ name, counter, counter, 0, ProfilerEventType::MARKER, value });
+}
+
+void Profiler::PushEvent(const ProfilerEvent &event)
+{
+    ThreadBuffer *buffer = GetThreadBuffer();
+    const Uint64 index = buffer->writeIndex.load(std::memory_order_relaxed);
+
+    ProfilerEvent &dst = buffer->events[index % PROFILER_BUFFER_SIZE];
+    dst = event;
+    dst.threadID = buffer->threadID;
+
+    buffer->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+double Profiler::CounterToMS(Uint64 counter)
+{
+    static const double frequency = (double)SDL_GetPerformanceFrequency();
+    return 1000.0 * (double)counter / frequency;
+}
+
+void Profiler::NewFrame()
+{
+    const Uint64 frameEnd = GetCounter();
+    if (s_frameBegin != 0)
+    {
+        s_frameMS = (float)CounterToMS(frameEnd - s_frameBegin);
+    }
+    s_frameBegin = frameEnd;
+
+    AllocTracker::NewFrame();
+
+    for (ProfilerZoneStats &zone : s_zones)
+    {
+        zone.ms = 0.f;
+        zone.callCount = 0;
+    }
+
+    CollectEvents();
+
+    for (ProfilerZoneStats &zone : s_zones)
+    {
+        zone.avgMs += PROFILER_SMOOTHING * (zone.ms - zone.avgMs);
+    }
+}
+
+void Profiler::CollectEvents()
+{
+    std::unique_lock<std::mutex> lock(s_mutex);
+    for (ThreadBuffer *buffer : s_buffers)
+    {
+        const Uint64 writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+        Uint64 readIndex = buffer->readIndex;
+
+        // Les mesures crases par le thread sont perdues
+        if (writeIndex - readIndex > PROFILER_BUFFER_SIZE)
+        {
+            readIndex = writeIndex - PROFILER_BUFFER_SIZE;
+        }
+
+        for (; readIndex < writeIndex; readIndex++)
+        {
+            ProfilerEvent event = buffer->events[readIndex % PROFILER_BUFFER_SIZE];
+
+            // Ignore la mesure si elle a t rcrite pendant la copie
+            const Uint64 lastIndex = buffer->writeIndex.load(std::memory_order_acquire);
+            if (lastIndex - readIndex > PROFILER_BUFFER_SIZE) continue;
+
+            ProcessEvent(event);
+        }
+        buffer->readIndex = writeIndex;
+    }
+}
+
+int Profiler::StartTrace(const std::string &path)
+{
+    StopTrace();
+
+    // Vide les tampons pour ne pas exporter les mesures antrieures
+    CollectEvents();
+
+    s_trace = new ProfilerTrace();
+    AssertNew(s_trace);
+
+    int exitStatus = s_trace->Open(path, GetCounter());
+    if (exitStatus == EXIT_FAILURE)
+    {
+        delete s_trace;
+        s_trace = nullptr;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Profiler trace started: " << path << std::endl;
+    return EXIT_SUCCESS;
+}
+
+void Profiler::StopTrace()
+{
+    if (s_trace == nullptr) return;
+
+    CollectEvents();
+
+    s_trace->Close();
+    delete s_trace;
+    s_trace = nullptr;
+
+    std::cout << "Profiler trace stopped" << std::endl;
+}
+
+void Profiler::ProcessEvent(const ProfilerEvent &event)
+{
+    if (s_trace) s_trace->WriteEvent(event);
+    if (event.type == ProfilerEventType::MARKER) return;
+
+    ProfilerZoneStats *zone = nullptr;
+    for (ProfilerZoneStats &other : s_zones)
+    {
+        if (other.name == event.name || strcmp(other.name, event.name) == 0)
+        {
+            zone = &other;
+            break;
+        }
+    }
+    if (zone == nullptr)
+    {
+        s_zones.push_back(ProfilerZoneStats{ event.name, 0.f, 0.f, 0 });
+        zone = &s_zones.back();
+    }
+
+    zone->ms += (float)CounterToMS(event.end - event.begin);
+    zone->callCount++;
+}
@@ -0,0 +1,235 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+#include "AllocTracker.h"
+
+#include <atomic>
+#include <mutex>
+
+// Commenter pour supprimer toutes les zones de mesure  la compilation
+#define PROFILER_ENABLED
+
+#define PROFILER_BUFFER_SIZE 4096
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef PROFILER_ENABLED
+/// @brief Mesure la dure du bloc courant.
+/// @param name nom de la zone (chane littrale).
+#  ifdef ALLOC_TRACKING_ENABLED
+#    define PROFILE_SCOPE(name) \
+       static const AllocZoneKey PROFILE_CONCAT(allocZone, __LINE__)(name); \
+       ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name, &PROFILE_CONCAT(allocZone, __LINE__))
+#  else
+#    define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#  endif
+#  define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+/// @brief Enregistre un vnement ponctuel.
+/// @param name nom de l'vnement (chane littrale).
+/// @param value valeur entire associe.
+#  define PROFILE_MARKER(name, value) Profiler::PushMarker(name, value)
+#else
+#  define PROFILE_SCOPE(name)
+#  define PROFILE_FUNCTION()
+#  define PROFILE_MARKER(name, value)
+#endif
+
+class ProfilerTrace;
+
+enum class ProfilerEventType : uint32_t
+{
+    ZONE, MARKER
+};
+
+/// @brief Mesure d'une zone, enregistre par le thread qui l'a excute.
+struct ProfilerEvent
+{
+    const char *name;
+    Uint64 begin;
+    Uint64 end;
+    int threadID;
+    ProfilerEventType type;
+
+    /// @brief Valeur associe  un vnement ponctuel.
+    int value;
+};
+
+/// @brief Statistiques d'une zone de mesure.
+struct ProfilerZoneStats
+{
+    const char *name;
+
+    /// @brief Dure cumule pendant la dernire frame (en millisecondes).
+    float ms;
+
+    /// @brief Dure moyenne par frame, lisse (en millisecondes).
+    float avgMs;
+
+    /// @brief Nombre d'excutions pendant la dernire frame.
+    int callCount;
+};
+
+/// @brief Profileur par zones.
+/// Chaque thread enregistre ses mesures dans son propre tampon circulaire,
+/// sans verrou. Les tampons sont vids par le thread principal  chaque
+/// appel de NewFrame().
+class Profiler
+{
+public:
+    /// @brief Collecte les mesures de tous les threads et met  jour
+    /// les statistiques des zones. Appele au dbut de chaque frame.
+    static void NewFrame();
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    static Uint64 GetCounter();
+    static double CounterToMS(Uint64 counter);
+
+    /// @brief Enregistre une mesure dans le tampon du thread appelant.
+    static void PushEvent(const char *name, Uint64 begin, Uint64 end);
+
+    /// @brief Enregistre un vnement ponctuel dans le tampon du thread appelant.
+    static void PushMarker(const char *name, int value);
+
+    /// @brief Commence l'export des mesures dans un fichier au format
+    /// Chrome Trace Event. Les mesures sont crites  chaque NewFrame().
+    /// @param path le chemin du fichier.
+    /// @return EXIT_SUCCESS ou EXIT_FAILURE.
+    static int StartTrace(const std::string &path);
+
+    /// @brief Ecrit les dernires mesures et ferme le fichier de trace.
+    static void StopTrace();
+    static bool IsTracing();
+
+    static const std::vector<ProfilerZoneStats> &GetZoneStats();
+    static float GetFrameMS();
+
+private:
+    class ThreadBuffer
+    {
+    public:
+        ThreadBuffer(int threadID);
+
+        std::array<ProfilerEvent, PROFILER_BUFFER_SIZE> events;
+        std::atomic<Uint64> writeIndex;
+        Uint64 readIndex;
+        int threadID;
+
+        /// @brief Boolen indiquant si le thread propritaire est termin.
+        std::atomic<bool> released;
+    };
+
+    class ThreadBufferHandle
+    {
+    public:
+        ThreadBufferHandle();
+        ~ThreadBufferHandle();
+
+        ThreadBuffer *buffer;
+    };
+
+    static ThreadBuffer *GetThreadBuffer();
+    static void PushEvent(const ProfilerEvent &event);
+    static void CollectEvents();
+    static void ProcessEvent(const ProfilerEvent &event);
+
+    static std::atomic<bool> s_enabled;
+    static std::mutex s_mutex;
+    static std::vector<ThreadBuffer *> s_buffers;
+    static int s_nextThreadID;
+
+    static std::vector<ProfilerZoneStats> s_zones;
+    static Uint64 s_frameBegin;
+    static float s_frameMS;
+
+    static ProfilerTrace *s_trace;
+};
+
+/// @brief Zone de mesure dont la dure est celle de la vie de l'objet.
+class ProfileScope
+{
+public:
+#ifdef ALLOC_TRACKING_ENABLED
+    ProfileScope(const char *name, const AllocZoneKey *allocZone);
+#else
+    ProfileScope(const char *name);
+#endif
+    ProfileScope(ProfileScope const&) = delete;
+    ProfileScope& operator=(ProfileScope const&) = delete;
+    ~ProfileScope();
+
+private:
+    const char *m_name;
+    Uint64 m_begin;
+
+#ifdef ALLOC_TRACKING_ENABLED
+    /// @brief Zone englobante,  laquelle les allocations sont attribues
+    /// aprs la sortie de cette zone.
+    const AllocZoneKey *m_parentZone;
+#endif
+};
+
+inline Uint64 Profiler::GetCounter()
+{
+    return SDL_GetPerformanceCounter();
+}
+
+inline void Profiler::SetEnabled(bool enabled)
+{
+    s_enabled = enabled;
+}
+
+inline bool Profiler::IsEnabled()
+{
+    return s_enabled;
+}
+
+inline const std::vector<ProfilerZoneStats> &Profiler::GetZoneStats()
+{
+    return s_zones;
+}
+
+inline float Profiler::GetFrameMS()
+{
+    return s_frameMS;
+}
+
+inline bool Profiler::IsTracing()
+{
+    return s_trace != nullptr;
+}
+
+#ifdef ALLOC_TRACKING_ENABLED
+inline ProfileScope::ProfileScope(const char *name, const AllocZoneKey *allocZone) :
+    m_name(name), m_begin(0)
+{
+    m_parentZone = AllocTracker::EnterZone(allocZone);
+#else
+inline ProfileScope::ProfileScope(const char *name) :
+    m_name(name), m_begin(0)
+{
+#endif
+    if (Profiler::IsEnabled())
+    {
+        m_begin = Profiler::GetCounter();
+    }
+}
+
+inline ProfileScope::~ProfileScope()
+{
+    if (m_begin != 0)
+    {
+        Profiler::PushEvent(m_name, m_begin, Profiler::GetCounter());
+    }
+#ifdef ALLOC_TRACKING_ENABLED
+    AllocTracker::LeaveZone(m_parentZone);
+#endif
+}
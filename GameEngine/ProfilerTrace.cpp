@@ -0,0 +1,137 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "ProfilerTrace.h"
+
+ProfilerTrace::ProfilerTrace() :
+    m_file(nullptr), m_origin(0), m_firstEvent(true), m_buffer(), m_size(0)
+{
+}
+
+ProfilerTrace::~ProfilerTrace()
+{
+    Close();
+}
+
+int ProfilerTrace::Open(const std::string &path, Uint64 origin)
+{
+    Close();
+
+    m_file = fopen(path.c_str(), "wb");
+    if (m_file == nullptr)
+    {
+        std::cout << "ERROR - Open trace file " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    m_origin = origin;
+    m_firstEvent = true;
+    m_size = 0;
+
+    const char header[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    Write(header, (int)sizeof(header) - 1);
+
+    return EXIT_SUCCESS;
+}
+
+void ProfilerTrace::Close()
+{
+    if (m_file == nullptr) return;
+
+    const char footer[] = "\n]}\n";
+    Write(footer, (int)sizeof(footer) - 1);
+    Flush();
+
+    fclose(m_file);
+    m_file = nullptr;
+}
+
+void ProfilerTrace::WriteEvent(const ProfilerEvent &event)
+{
+    if (m_file == nullptr) return;
+
+    // Les vnements antrieurs  l'ouverture sont ignors
+    if (event.begin < m_origin) return;
+
+    char buffer[128] = { 0 };
+    int size = 0;
+
+    if (m_firstEvent == false)
+    {
+        Write(",\n", 2);
+    }
+    m_firstEvent = false;
+
+    Write("{\"name\":\"", 9);
+    WriteName(event.name);
+
+    const double ts = 1000.0 * Profiler::CounterToMS(event.begin - m_origin);
+    if (event.type == ProfilerEventType::MARKER)
+    {
+        size = snprintf(
+            buffer, sizeof(buffer),
+            "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,"
+            "\"args\":{\"value\":%d}}",
+            event.threadID, ts, event.value
+        );
+    }
+    else
+    {
+        const double dur = 1000.0 * Profiler::CounterToMS(event.end - event.begin);
+        size = snprintf(
+            buffer, sizeof(buffer),
+            "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+            event.threadID, ts, dur
+        );
+    }
+    Write(buffer, std::min(size, (int)sizeof(buffer) - 1));
+}
+
+void ProfilerTrace::Write(const char *str, int size)
+{
+    if (m_size + size > PROFILER_TRACE_BUFFER_SIZE)
+    {
+        Flush();
+    }
+    memcpy(m_buffer.data() + m_size, str, size);
+    m_size += size;
+}
+
+void ProfilerTrace::WriteName(const char *name)
+{
+    // Echappe les caractres spciaux du JSON
+    for (const char *c = name; *c != '\0'; c++)
+    {
+        char buffer[8] = { 0 };
+        int size = 0;
+        if (*c == '"' || *c == '\\')
+        {
+            buffer[0] = '\\';
+            buffer[1] = *c;
+            size = 2;
+        }
+        else if ((unsigned char)*c < 0x20)
+        {
+            size = snprintf(buffer, sizeof(buffer), "\\u%04x", (int)(unsigned char)*c);
+        }
+        else
+        {
+            buffer[0] = *c;
+            size = 1;
+        }
+        Write(buffer, size);
+    }
+}
+
+void ProfilerTrace::Flush()
+{
+    if (m_file && m_size > 0)
+    {
+        fwrite(m_buffer.data(), 1, m_size, m_file);
+        fflush(m_file);
+    }
+    m_size = 0;
+}
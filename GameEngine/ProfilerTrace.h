@@ -0,0 +1,55 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+#include "Profiler.h"
+
+#define PROFILER_TRACE_BUFFER_SIZE (64 * 1024)
+
+/// @brief Ecriture des mesures du profileur dans un fichier au format
+/// Chrome Trace Event (JSON), lisible par chrome://tracing ou Perfetto.
+/// Les vnements sont crits au fil de l'eau  travers un tampon de taille
+/// fixe, la mmoire utilise ne dpend donc pas de la dure de la session.
+class ProfilerTrace
+{
+public:
+    ProfilerTrace();
+    ProfilerTrace(ProfilerTrace const&) = delete;
+    ProfilerTrace& operator=(ProfilerTrace const&) = delete;
+    ~ProfilerTrace();
+
+    /// @brief Ouvre le fichier de trace.
+    /// @param path le chemin du fichier.
+    /// @param origin la valeur du compteur correspondant au temps zro.
+    /// @return EXIT_SUCCESS ou EXIT_FAILURE.
+    int Open(const std::string &path, Uint64 origin);
+
+    /// @brief Termine le document JSON et ferme le fichier.
+    void Close();
+
+    bool IsOpen() const;
+
+    void WriteEvent(const ProfilerEvent &event);
+
+private:
+    void Write(const char *str, int size);
+    void WriteName(const char *name);
+    void Flush();
+
+    FILE *m_file;
+    Uint64 m_origin;
+    bool m_firstEvent;
+
+    std::array<char, PROFILER_TRACE_BUFFER_SIZE> m_buffer;
+    int m_size;
+};
+
+inline bool ProfilerTrace::IsOpen() const
+{
+    return m_file != nullptr;
+}
@@ -9,13 +9,15 @@
 #include "SceneManager.h"
 #include "UICanvas.h"
 
-#define TIME_STEP_MS 20
+#define FIXED_STEP_RATE 50
+#define TIMER_TICK_MS 1
+#define FIXED_STEP_BUDGET_MS 8.f
+#define FIXED_STEP_MAX_COUNT 4
+#define FIXED_STEP_OVERLOAD_FRAMES 60
 
 GameCollision::GameCollision(b2Contact *contact, bool first) :
-    m_contact(contact), m_first(first)
+    m_contact(contact), m_first(first), m_hasManifold(false), m_manifold()
 {
-    contact->GetWorldManifold(&manifold);
-
     if (first)
     {
         fixture = contact->GetFixtureA();
@@ -23,7 +25,6 @@ GameCollision::GameCollision(b2Contact *contact, bool first) :
     }
     else
     {
-        manifold.normal = -manifold.normal;
         fixture = contact->GetFixtureB();
         otherFixture = contact->GetFixtureA();
     }
@@ -33,14 +34,22 @@ GameCollision::GameCollision(b2Contact *contact, bool first) :
 
 Scene::Scene(SceneManager *manager, InputManager *inputManager) :
     m_sceneManager(manager), m_inputManager(inputManager),
-    m_stepAccuMS(0), m_alpha(0.f), m_drawPhysics(false), m_drawGizmos(false), m_drawGrid(false),
+    m_stepAccu(0), m_fixedElapsedMS(0), m_fixedElapsedRem(0),
+    m_fixedStepBudgetMS(FIXED_STEP_BUDGET_MS), m_maxFixedStepCount(FIXED_STEP_MAX_COUNT),
+    m_fixedStepCostMS(0.f), m_overloadFrames(0), m_alpha(0.f), m_drawPhysics(false), m_drawGizmos(false), m_drawGrid(false),
     m_makeStep(false), m_mode(UpdateMode::REALTIME),
-    m_objectManager(), m_quit(false), m_timeStepMS(TIME_STEP_MS), m_inFixedUpdate(false),
+    m_objectManager(), m_quit(false), m_fixedStepRate(FIXED_STEP_RATE), m_timeStepMS(1000 / FIXED_STEP_RATE), m_inFixedUpdate(false),
     m_time(), m_assetManager(),
     m_contactListener(), m_particleSystemMap(),
-    m_world(b2Vec2(0.f, -40.f)), m_queryGizmos(), m_gizmos(this), m_updateID(0)
+    m_world(b2Vec2(0.f, -40.f)), m_queryGizmos(&m_stepArena), m_gizmos(this), m_updateID(0),
+    m_jobSystem(), m_triggerSystem(), m_animationSystem(), m_fixedAnimationSystem(),
+    m_parallelObjects(), m_parallelGroups(), m_parallelContexts(), m_objectPools(),
+    m_stats(), m_fixedStepAllocBudget(-1), m_frameArena(), m_stepArena(),
+    m_timers((float)TIMER_TICK_MS / 1000.f), m_fixedTimers(1.f / (float)FIXED_STEP_RATE)
 {
     m_world.SetContactListener(&m_contactListener);
+    m_objectManager.SetFrameArena(&m_frameArena);
+    m_time.Start();
     m_activeCam = nullptr;
     m_canvas = new UICanvas(this);
 
@@ -54,6 +63,12 @@ Scene::Scene(SceneManager *manager, InputManager *inputManager) :
 Scene::~Scene()
 {
     m_objectManager.DeleteObjects();
+
+    for (auto &it : m_objectPools)
+    {
+        delete it.second;
+    }
+    m_objectPools.clear();
 }
 
 class DrawQueryCallback : public b2QueryCallback
@@ -86,6 +101,8 @@ private:
 
 void Scene::Render()
 {
+    PROFILE_SCOPE("Scene::Render");
+
     if (m_activeCam == nullptr)
     {
         return;
@@ -96,17 +113,28 @@ void Scene::Render()
     // Dtermine les objets visibles par la camra
     b2AABB worldView = m_activeCam->GetWorldView();
     m_objectManager.AddVisibleBodies(m_world, worldView);
+    m_objectManager.ProcessVisibleObjects();
+    m_stats.visibleCount = m_objectManager.GetVisibleCount();
 
     // Dessine les objets visibles par la camra
     // Message : Render()
-    m_objectManager.ProcessVisibleObjects();
-    for (auto it = m_objectManager.visibleObjectsBegin();
-         it != m_objectManager.visibleObjectsEnd(); ++it)
+    const int uiLayer = (m_canvas && m_canvas->IsCacheEnabled())
+        ? m_canvas->GetCacheLayer() : INT_MAX;
+    auto it = m_objectManager.visibleObjectsBegin();
+    for (; it != m_objectManager.visibleObjectsEnd(); ++it)
     {
         GameObject *object = *it;
+        if (object->GetLayer() >= uiLayer) break;
+
         object->Render();
     }
 
+    // L'interface est dessine par le canvas, depuis son cache si elle n'a pas chang
+    if (it != m_objectManager.visibleObjectsEnd())
+    {
+        m_canvas->RenderLayers(it, m_objectManager.visibleObjectsEnd());
+    }
+
     // Dessine la grille
     if (m_drawGrid)
     {
@@ -149,6 +177,10 @@ void Scene::Render()
         b2AABB worldView = m_activeCam->GetWorldView();
         DrawQueryCallback drawCallback(this);
         m_world.QueryAABB(&drawCallback, worldView);
+
+        Gizmos gizmos(this);
+        gizmos.SetColor(Color(255, 200, 0));
+        m_triggerSystem.DrawGizmos(gizmos);
     }
 
     // Dessine les gizmos
@@ -165,11 +197,10 @@ void Scene::Render()
         }
 
         // Dessine les gizmos automatiques
-        for (auto it = m_queryGizmos.begin(); it != m_queryGizmos.end(); ++it)
+        for (const QueryGizmos &autoGizmos : m_queryGizmos)
         {
-            QueryGizmos *autoGizmos = *it;
-            gizmos.SetColor(autoGizmos->m_color);
-            gizmos.DrawShape(autoGizmos->m_shape);
+            gizmos.SetColor(autoGizmos.m_color);
+            gizmos.DrawShape(autoGizmos.m_shape);
         }
     }
 }
@@ -181,8 +212,21 @@ void Scene::PrintGameObjects() const
 
 void Scene::Update()
 {
+    // Collecte les mesures de la frame prcdente
+    Profiler::NewFrame();
+
+    PROFILE_SCOPE("Scene::Update");
     m_updateID++;
 
+    // Les donnes temporaires de la frame prcdente ne sont plus utilises
+    m_frameArena.Reset();
+
+    // Remplace les feuilles de sprites modifies sur le disque
+    if (m_assetManager.HasPendingReloads())
+    {
+        m_assetManager.ProcessReloads();
+    }
+
     // Appelle les mthodes asynchrones
     // Messages : Start(), OnEnable(), OnDisable(), Delete()
     m_objectManager.ProcessObjects();
@@ -193,25 +237,62 @@ void Scene::Update()
     // Met  jour les objets
     // Messages : Update(), FixedUpdate()
     UpdateGameObjects();
-}
 
+    m_stats.objectCount = m_objectManager.GetObjectCount();
+    m_stats.bodyCount = m_world.GetBodyCount();
+}
 
-void Scene::MakeFixedStep()
+void Scene::MakeFixedStep(int stepIndex)
 {
-    const float timeStep = (float)m_timeStepMS / 1000.f;
+    PROFILE_SCOPE("Scene::MakeFixedStep");
+    PROFILE_MARKER("Scene::FixedStep", stepIndex);
+    ALLOC_BUDGET_SCOPE("Scene::MakeFixedStep", m_fixedStepAllocBudget);
+
+    const float timeStep = GetFixedTimeStep();
     m_inFixedUpdate = true;
 
-    for (QueryGizmos *autoGizmos : m_queryGizmos)
+    // Temps simul exact, mme si le pas n'est pas un nombre entier de ms
+    const Uint64 elapsedNum = 1000 + m_fixedElapsedRem;
+    m_fixedElapsedMS += elapsedNum / m_fixedStepRate;
+    m_fixedElapsedRem = elapsedNum % m_fixedStepRate;
+
+    // Le tableau des formes des requtes est abandonn avant de vider l'arne
+    m_queryGizmos = ArenaVector<QueryGizmos>(&m_stepArena);
+    m_stepArena.Reset();
+
+    // Appelle les fonctions des minuteries arrives  chance
     {
-        delete autoGizmos;
+        PROFILE_SCOPE("Scene::FixedTimers");
+        m_fixedTimers.Tick();
     }
-    m_queryGizmos.clear();
 
     if (m_sceneManager) m_sceneManager->OnSceneFixedUpdate();
 
     int32 velocityIterations = 6;
     int32 positionIterations = 2;
-    m_world.Step(timeStep, velocityIterations, positionIterations);
+    {
+        PROFILE_SCOPE("b2World::Step");
+        m_world.Step(timeStep, velocityIterations, positionIterations);
+    }
+
+    // Teste les volumes de dclenchement
+    // Messages : OnTriggerEnter(), OnTriggerStay(), OnTriggerExit()
+    {
+        PROFILE_SCOPE("TriggerSystem::Update");
+        m_triggerSystem.Update();
+    }
+
+    // Met  jour en parallle les objets qui le demandent
+    // Message : ParallelFixedUpdate()
+    MakeParallelFixedUpdate();
+
+    // Avance les animations du pas fixe
+    // Messages : OnAnimationStart(), OnCycleEnd(), OnAnimationEnd(), OnFrameChanged()
+    {
+        PROFILE_SCOPE("AnimationSystem::Update");
+        m_fixedAnimationSystem.Update(AnimClock::FIXED, timeStep);
+        m_fixedAnimationSystem.DispatchEvents();
+    }
 
     for (auto it = m_objectManager.begin(); it != m_objectManager.end(); ++it)
     {
@@ -230,29 +311,155 @@ void Scene::MakeFixedStep()
     m_inFixedUpdate = false;
 }
 
-void Scene::UpdateGameObjects()
+void Scene::MakeParallelFixedUpdate()
 {
-    // Appelle la mthode FixedUpdate de chaque GameObject
+    PROFILE_SCOPE("Scene::ParallelFixedUpdate");
+
+    m_parallelObjects.clear();
+    for (auto it = m_objectManager.begin(); it != m_objectManager.end(); ++it)
+    {
+        GameObject *object = *it;
+        if (object->IsEnabled() && object->UsesParallelFixedUpdate())
+        {
+            m_parallelObjects.push_back(object);
+        }
+    }
+    if (m_parallelObjects.empty()) return;
+
+    // Regroupe les objets qui modifient les mmes donnes
+    std::stable_sort(
+        m_parallelObjects.begin(), m_parallelObjects.end(),
+        [](const GameObject *objectA, const GameObject *objectB)
+        {
+            return std::less<const void *>()(
+                objectA->GetParallelWriteKey(), objectB->GetParallelWriteKey());
+        }
+    );
+
+    m_parallelGroups.clear();
+    for (int i = 0; i < (int)m_parallelObjects.size(); i++)
+    {
+        if (i == 0 || m_parallelObjects[i]->GetParallelWriteKey() !=
+            m_parallelObjects[i - 1]->GetParallelWriteKey())
+        {
+            m_parallelGroups.push_back(i);
+        }
+    }
+    const int groupCount = (int)m_parallelGroups.size();
+    m_parallelGroups.push_back((int)m_parallelObjects.size());
+
+    while ((int)m_parallelContexts.size() < groupCount)
+    {
+        m_parallelContexts.emplace_back(this);
+    }
+
+    m_jobSystem.ParallelFor(groupCount, [this](int groupID)
+    {
+        FixedUpdateContext &context = m_parallelContexts[groupID];
+        for (int i = m_parallelGroups[groupID]; i < m_parallelGroups[groupID + 1]; i++)
+        {
+            m_parallelObjects[i]->ParallelFixedUpdate(context);
+        }
+    });
+
+    // Applique les commandes dans l'ordre des groupes
+    for (int i = 0; i < groupCount; i++)
+    {
+        m_parallelContexts[i].Apply();
+    }
+}
+
+int Scene::ApplyFixedStepBudget(int stepCount)
+{
+    // Nombre de pas que le budget permet d'excuter
+    int maxStepCount = m_maxFixedStepCount;
+    if (m_fixedStepCostMS > 0.f)
+    {
+        const int budgetCount = (int)(m_fixedStepBudgetMS / m_fixedStepCostMS);
+        maxStepCount = std::max(1, std::min(maxStepCount, budgetCount));
+    }
+
+    const bool overBudget = (float)stepCount * m_fixedStepCostMS > m_fixedStepBudgetMS;
+    int droppedCount = 0;
+    if (stepCount > maxStepCount)
+    {
+        // Le temps des pas en trop est abandonn : le jeu ralentit
+        droppedCount = stepCount - maxStepCount;
+        stepCount = maxStepCount;
+        PROFILE_MARKER("Scene::DroppedFixedSteps", droppedCount);
+    }
+
+    if (droppedCount > 0 || overBudget)
+    {
+        m_overloadFrames = FIXED_STEP_OVERLOAD_FRAMES;
+    }
+    else if (m_overloadFrames > 0)
+    {
+        m_overloadFrames--;
+    }
+
+    m_stats.droppedStepCount = droppedCount;
+    m_stats.totalDroppedStepCount += droppedCount;
+    m_stats.fixedStepCostMS = m_fixedStepCostMS;
+    m_stats.fixedStepOverloaded = IsFixedStepOverloaded();
+
+    return stepCount;
+}
+
+void Scene::MakeFixedSteps(int stepCount)
+{
+    const double frequency = (double)SDL_GetPerformanceFrequency();
+    for (int i = 0; i < stepCount; i++)
+    {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        MakeFixedStep(i);
+        const Uint64 end = SDL_GetPerformanceCounter();
+
+        // Moyenne glissante de la dure d'un pas
+        const float costMS = (float)(1000.0 * (double)(end - start) / frequency);
+        m_fixedStepCostMS = (m_fixedStepCostMS > 0.f)
+            ? 0.9f * m_fixedStepCostMS + 0.1f * costMS
+            : costMS;
+    }
+}
+
+void Scene::SetFixedStepRate(int stepsPerSecond)
+{
+    assert(stepsPerSecond > 0);
+    m_fixedStepRate = (Uint64)std::max(stepsPerSecond, 1);
+    m_timeStepMS = (1000 + m_fixedStepRate / 2) / m_fixedStepRate;
+    m_fixedElapsedRem = 0;
+    m_fixedTimers.SetTickDuration(GetFixedTimeStep());
+}
+
+int Scene::UpdateTime()
+{
+    int stepCount = 0;
     if (m_mode == UpdateMode::REALTIME)
     {
         // Mode temps rel
         m_time.Update();
 
-        m_stepAccuMS += m_time.GetDeltaMS();
-        while (m_stepAccuMS >= m_timeStepMS)
+        // L'accumulateur compte en ticks multiplis par le nombre de pas par seconde :
+        // un pas correspond exactement  la frquence du compteur.
+        const Uint64 frequency = m_time.GetFrequency();
+        m_stepAccu += m_time.GetDeltaTicks() * m_fixedStepRate;
+        while (m_stepAccu >= frequency)
         {
-            MakeFixedStep();
-            m_stepAccuMS -= m_timeStepMS;
+            stepCount++;
+            m_stepAccu -= frequency;
         }
-        m_alpha = (float)m_stepAccuMS / (float)m_timeStepMS;
+        m_alpha = (float)((double)m_stepAccu / (double)frequency);
+
+        stepCount = ApplyFixedStepBudget(stepCount);
     }
     else
     {
         // Mode pas  pas
         if (m_makeStep)
         {
-            m_time.Update(m_timeStepMS);
-            MakeFixedStep();
+            m_time.Update(GetFixedTimeStep());
+            stepCount = 1;
         }
         else
         {
@@ -261,9 +468,37 @@ void Scene::UpdateGameObjects()
         m_makeStep = false;
         m_alpha = 1.f;
     }
+    m_stats.fixedStepCount = stepCount;
+    return stepCount;
+}
+
+void Scene::UpdateGameObjects()
+{
+    // Appelle la mthode FixedUpdate de chaque GameObject
+    int stepCount = UpdateTime();
+    MakeFixedSteps(stepCount);
+
+    UpdateObjects();
+}
+
+void Scene::UpdateObjects()
+{
+    PROFILE_SCOPE("Scene::UpdateObjects");
 
     if (m_sceneManager) m_sceneManager->OnSceneUpdate();
 
+    // Appelle les fonctions des minuteries arrives  chance
+    m_timers.Advance(m_time.GetDelta());
+
+    // Avance les animations de la frame
+    // Messages : OnAnimationStart(), OnCycleEnd(), OnAnimationEnd(), OnFrameChanged()
+    {
+        PROFILE_SCOPE("AnimationSystem::Update");
+        m_animationSystem.Update(AnimClock::SCENE, m_time.GetDelta());
+        m_animationSystem.Update(AnimClock::UNSCALED, m_time.GetUnscaledDelta());
+        m_animationSystem.DispatchEvents();
+    }
+
     // Appelle la mthode Update de chaque GameObject
     int enabledCount = 0;
     for (auto it = m_objectManager.begin();
@@ -276,6 +511,7 @@ void Scene::UpdateGameObjects()
             enabledCount++;
         }
     }
+    m_stats.disabledCount = m_objectManager.GetObjectCount() - enabledCount;
 }
 
 ParticleSystem *Scene::GetParticleSystem(int layer)
@@ -299,8 +535,8 @@ void Scene::ShakeCamera(int intensity)
 
 void Scene::PushQueryGizmos(Color color, b2Vec2 point1, b2Vec2 point2)
 {
-    m_queryGizmos.insert(
-        new QueryGizmos(color, GizmosShape(point1, point2))
+    m_queryGizmos.push_back(
+        QueryGizmos(color, GizmosShape(point1, point2))
     );
 }
 
@@ -308,21 +544,21 @@ void Scene::PushQueryGizmos(Color color, b2Fixture *fixture)
 {
     const b2Transform &xf = fixture->GetBody()->GetTransform();
     const b2Shape &fixtureShape = *(fixture->GetShape());
-    m_queryGizmos.insert(
-        new QueryGizmos(color, GizmosShape(fixtureShape, xf))
+    m_queryGizmos.push_back(
+        QueryGizmos(color, GizmosShape(fixtureShape, xf))
     );
 }
 
 void Scene::PushQueryGizmos(Color color, const b2AABB &aabb)
 {
-    m_queryGizmos.insert(
-        new QueryGizmos(color, GizmosShape(aabb))
+    m_queryGizmos.push_back(
+        QueryGizmos(color, GizmosShape(aabb))
     );
 }
 
 void Scene::PushQueryGizmos(Color color, const GizmosShape &shape)
 {
-    m_queryGizmos.insert(new QueryGizmos(color, shape));
+    m_queryGizmos.push_back(QueryGizmos(color, shape));
 }
 
 class SceneRayCastCallback : public b2RayCastCallback
@@ -384,12 +620,12 @@ RayHit Scene::RayCastFirstGizmos(
         b2Fixture *fixture = firstHit.fixture;
         if (fixture)
         {
-            m_queryGizmos.insert(new QueryGizmos(hitColor, GizmosShape(fixture)));
-            m_queryGizmos.insert(new QueryGizmos(hitColor, GizmosShape(point1, point2)));
+            m_queryGizmos.push_back(QueryGizmos(hitColor, GizmosShape(fixture)));
+            m_queryGizmos.push_back(QueryGizmos(hitColor, GizmosShape(point1, point2)));
         }
         else
         {
-            m_queryGizmos.insert(new QueryGizmos(defaultColor, GizmosShape(point1, point2)));
+            m_queryGizmos.push_back(QueryGizmos(defaultColor, GizmosShape(point1, point2)));
 
         }
     }
@@ -453,11 +689,11 @@ void Scene::RayCastGizmos(
     if (m_drawGizmos)
     {
         Color color = result.empty() ? defaultColor : hitColor;
-        m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(point1, point2)));
+        m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(point1, point2)));
         for (auto it = result.begin(); it != result.end(); ++it)
         {
             const RayHit &rayHit = *it;
-            m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(rayHit.fixture)));
+            m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(rayHit.fixture)));
         }
     }
 }
@@ -578,11 +814,11 @@ void Scene::OverlapAABBGizmos(
     if (m_drawGizmos)
     {
         Color color = result.empty() ? defaultColor : hitColor;
-        m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(aabb)));
+        m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(aabb)));
         for (auto it = result.begin(); it != result.end(); ++it)
         {
             const OverlapResult &overlap = *it;
-            m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(overlap.fixture)));
+            m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(overlap.fixture)));
         }
     }
 }
@@ -619,11 +855,11 @@ void Scene::OverlapCircleGizmos(
         circleShape.m_radius = radius;
 
         Color color = result.empty() ? defaultColor : hitColor;
-        m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(circleShape, xf)));
+        m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(circleShape, xf)));
         for (auto it = result.begin(); it != result.end(); ++it)
         {
             const OverlapResult &overlap = *it;
-            m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(overlap.fixture)));
+            m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(overlap.fixture)));
         }
     }
 }
@@ -658,11 +894,11 @@ void Scene::OverlapBoxGizmos(
         boxShape.SetAsBox(halfExtents.x, halfExtents.y, center, angleDeg * b2_pi / 180.f);
 
         Color color = result.empty() ? defaultColor : hitColor;
-        m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(boxShape, xf)));
+        m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(boxShape, xf)));
         for (auto it = result.begin(); it != result.end(); ++it)
         {
             const OverlapResult &overlap = *it;
-            m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(overlap.fixture)));
+            m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(overlap.fixture)));
         }
     }
 }
@@ -702,11 +938,11 @@ void Scene::OverlapPolygonGizmos(
         polygonShape.Set(b2ComputeHull(vertices, vertexCount));
 
         Color color = result.empty() ? defaultColor : hitColor;
-        m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(polygonShape, xf)));
+        m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(polygonShape, xf)));
         for (auto it = result.begin(); it != result.end(); ++it)
         {
             const OverlapResult &overlap = *it;
-            m_queryGizmos.insert(new QueryGizmos(color, GizmosShape(overlap.fixture)));
+            m_queryGizmos.push_back(QueryGizmos(color, GizmosShape(overlap.fixture)));
         }
     }
 }
@@ -719,39 +955,51 @@ float Scene::GetUIPixelsPerUnit() const
 
 void SceneContactListener::BeginContact(b2Contact *contact)
 {
-    GameBody *gameBodyA = GameBody::GetFromBody(contact->GetFixtureA()->GetBody());
-    GameBody *gameBodyB = GameBody::GetFromBody(contact->GetFixtureB()->GetBody());
-    assert(gameBodyA && gameBodyB);
-
-    GameCollision gameCollisionA(contact, true);
-    GameCollision gameCollisionB(contact, false);
-
-    gameBodyA->OnCollisionEnter(gameCollisionA);
-    gameBodyB->OnCollisionEnter(gameCollisionB);
+    DispatchContact(contact, CONTACT_ENTER);
 }
 
 void SceneContactListener::EndContact(b2Contact *contact)
 {
-    GameBody *gameBodyA = GameBody::GetFromBody(contact->GetFixtureA()->GetBody());
-    GameBody *gameBodyB = GameBody::GetFromBody(contact->GetFixtureB()->GetBody());
-    assert(gameBodyA && gameBodyB);
-
-    GameCollision gameCollisionA(contact, true);
-    GameCollision gameCollisionB(contact, false);
-
-    gameBodyA->OnCollisionExit(gameCollisionA);
-    gameBodyB->OnCollisionExit(gameCollisionB);
+    DispatchContact(contact, CONTACT_EXIT);
 }
 
 void SceneContactListener::PreSolve(b2Contact *contact, const b2Manifold *oldManifold)
 {
-    GameBody *gameBodyA = GameBody::GetFromBody(contact->GetFixtureA()->GetBody());
-    GameBody *gameBodyB = GameBody::GetFromBody(contact->GetFixtureB()->GetBody());
+    DispatchContact(contact, CONTACT_STAY);
+}
+
+void SceneContactListener::DispatchContact(b2Contact *contact, ContactEvent event)
+{
+    b2Fixture *fixtureA = contact->GetFixtureA();
+    b2Fixture *fixtureB = contact->GetFixtureB();
+    GameBody *gameBodyA = GameBody::GetFromBody(fixtureA->GetBody());
+    GameBody *gameBodyB = GameBody::GetFromBody(fixtureB->GetBody());
     assert(gameBodyA && gameBodyB);
 
-    GameCollision gameCollisionA(contact, true);
-    GameCollision gameCollisionB(contact, false);
+    // Ignore les corps qui ne sont pas abonns au message
+    const bool notifyA = gameBodyA->ListensContact(event, fixtureB->GetFilterData().categoryBits);
+    const bool notifyB = gameBodyB->ListensContact(event, fixtureA->GetFilterData().categoryBits);
 
-    gameBodyA->OnCollisionStay(gameCollisionA);
-    gameBodyB->OnCollisionStay(gameCollisionB);
+    if (notifyA)
+    {
+        GameCollision gameCollisionA(contact, true);
+        switch (event)
+        {
+        case CONTACT_ENTER: gameBodyA->OnCollisionEnter(gameCollisionA); break;
+        case CONTACT_STAY:  gameBodyA->OnCollisionStay(gameCollisionA);  break;
+        case CONTACT_EXIT:  gameBodyA->OnCollisionExit(gameCollisionA);  break;
+        default: break;
+        }
+    }
+    if (notifyB)
+    {
+        GameCollision gameCollisionB(contact, false);
+        switch (event)
+        {
+        case CONTACT_ENTER: gameBodyB->OnCollisionEnter(gameCollisionB); break;
+        case CONTACT_STAY:  gameBodyB->OnCollisionStay(gameCollisionB);  break;
+        case CONTACT_EXIT:  gameBodyB->OnCollisionExit(gameCollisionB);  break;
+        default: break;
+        }
+    }
 }
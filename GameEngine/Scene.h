@@ -9,17 +9,35 @@
 #include "Settings.h"
 #include "Timer.h"
 #include "Common.h"
-#include "inputManager.h"
+#include "InputManager.h"
 #include "ObjectManager.h"
 #include "AssetManager.h"
 #include "Gizmos.h"
+#include "JobSystem.h"
+#include "FixedUpdateContext.h"
+#include "TriggerSystem.h"
+#include "AnimationSystem.h"
+#include "ObjectPool.h"
+#include "Profiler.h"
+#include "FrameArena.h"
+#include "TimerWheel.h"
+
+#include <typeindex>
 
 class SceneManager;
 class UICanvas;
 class Camera;
 class GameBody;
 class ParticleSystem;
-struct QueryGizmos;
+
+struct QueryGizmos
+{
+    QueryGizmos(Color color, GizmosShape shape) :
+        m_color(color), m_shape(shape) { }
+
+    Color m_color;
+    GizmosShape m_shape;
+};
 
 struct SceneStats
 {
@@ -37,6 +55,32 @@ struct SceneStats
 
     /// @brief Nombre de corps prsents dans le moteur physique.
     int bodyCount;
+
+    /// @brief Nombre de pas fixes effectus pendant la frame.
+    int fixedStepCount;
+
+    /// @brief Nombre de pas fixes abandonns pendant la frame
+    /// pour respecter le budget des pas fixes.
+    int droppedStepCount;
+
+    /// @brief Nombre total de pas fixes abandonns depuis la cration de la scne.
+    Uint64 totalDroppedStepCount;
+
+    /// @brief Dure moyenne d'excution d'un pas fixe (en millisecondes).
+    float fixedStepCostMS;
+
+    /// @brief Boolen indiquant si les pas fixes dpassent leur budget.
+    bool fixedStepOverloaded;
+};
+
+/// @brief Messages de collision auxquels un GameBody peut s'abonner.
+enum ContactEvent : uint32_t
+{
+    CONTACT_NONE  = 0,
+    CONTACT_ENTER = 1 << 0,
+    CONTACT_STAY  = 1 << 1,
+    CONTACT_EXIT  = 1 << 2,
+    CONTACT_ALL   = CONTACT_ENTER | CONTACT_STAY | CONTACT_EXIT
 };
 
 class SceneContactListener : public b2ContactListener
@@ -46,6 +90,11 @@ public:
     virtual void BeginContact(b2Contact *contact) override;
     virtual void EndContact(b2Contact *contact) override;
     virtual void PreSolve(b2Contact *contact, const b2Manifold *oldManifold) override;
+
+private:
+    /// @brief Transmet un message de collision aux corps abonns.
+    /// Les GameCollision ne sont construites que pour ces corps.
+    void DispatchContact(b2Contact *contact, ContactEvent event);
 };
 
 class GameCollision
@@ -53,19 +102,38 @@ class GameCollision
 public:
     GameCollision(b2Contact *contact, bool first);
 
-    b2WorldManifold manifold;
     b2Fixture *fixture;
     b2Fixture *otherFixture;
     GameBody *gameBody;
 
+    /// @brief Renvoie les informations de contact dans le repre du monde.
+    /// Elles ne sont calcules qu'au premier appel.
+    const b2WorldManifold &GetManifold();
+
     bool IsEnabled() const;
     void SetEnabled(bool enabled);
 
 private:
     b2Contact *m_contact;
     bool m_first;
+    bool m_hasManifold;
+    b2WorldManifold m_manifold;
 };
 
+inline const b2WorldManifold &GameCollision::GetManifold()
+{
+    if (m_hasManifold == false)
+    {
+        m_contact->GetWorldManifold(&m_manifold);
+        if (m_first == false)
+        {
+            m_manifold.normal = -m_manifold.normal;
+        }
+        m_hasManifold = true;
+    }
+    return m_manifold;
+}
+
 inline bool GameCollision::IsEnabled() const
 {
     return m_contact->IsEnabled();
@@ -144,6 +212,20 @@ public:
     const float GetDelta() const;
     const Uint64 GetDeltaMS() const;
 
+    /// @brief Renvoie le temps simul par les pas fixes depuis la cration de la scne.
+    /// Ce temps avance exactement d'un pas de temps fixe  chaque pas.
+    const float GetFixedElapsed() const;
+    const Uint64 GetFixedElapsedMS() const;
+
+    /// @brief Dfinit le nombre de pas fixes par seconde (50 par dfaut).
+    /// Doit tre appele en dehors des pas fixes.
+    /// @param stepsPerSecond le nombre de pas par seconde (par exemple 60 ou 120).
+    void SetFixedStepRate(int stepsPerSecond);
+    int GetFixedStepRate() const;
+
+    /// @brief Renvoie la dure d'un pas fixe (en secondes).
+    float GetFixedTimeStep() const;
+
     RayHit RayCastFirst(
         b2Vec2 point1, b2Vec2 point2, const QueryFilter &filter
     );
@@ -228,6 +310,64 @@ public:
     void MakeStep();
     Uint64 GetUpdateID() const;
 
+    JobSystem &GetJobSystem();
+    TriggerSystem &GetTriggerSystem();
+
+    /// @brief Renvoie le systme qui avance les animations d'une horloge.
+    /// Les animations de l'horloge AnimClock::FIXED ont leur propre systme,
+    /// avanc au dbut de chaque pas fixe avant les FixedUpdate() :
+    /// elles doivent y tre cres pour avancer. Les autres avancent avant les Update().
+    /// @param clock l'horloge des animations.
+    AnimationSystem *GetAnimationSystem(AnimClock clock = AnimClock::SCENE);
+
+    /// @brief Renvoie les statistiques de la scne, mises  jour  chaque frame.
+    const SceneStats &GetStats() const;
+
+    /// @brief Dfinit le budget des pas fixes d'une frame.
+    /// Le nombre de pas d'une frame est limit par maxStepCount et par le
+    /// nombre de pas que le budget permet d'excuter, d'aprs la dure
+    /// mesure des pas prcdents (au moins un pas par frame).
+    /// Le temps des pas abandonns est perdu : le jeu ralentit au lieu
+    /// de prendre de plus en plus de retard.
+    /// @param budgetMS la dure maximale des pas fixes d'une frame (en millisecondes).
+    /// @param maxStepCount le nombre maximal de pas fixes par frame.
+    void SetFixedStepBudget(float budgetMS, int maxStepCount);
+
+    /// @brief Boolen indiquant si les pas fixes dpassent leur budget
+    /// depuis peu. Les objets peuvent alors allger leur travail
+    /// (rflexion des IA, mission de particules...).
+    bool IsFixedStepOverloaded() const;
+
+    /// @brief Dfinit le nombre maximal d'allocations d'un pas fixe,
+    /// vrifi par une assertion si ALLOC_TRACKING_ENABLED est dfini.
+    /// Seules les allocations du thread qui excute le pas sont comptes.
+    /// @param maxCount le nombre maximal d'allocations, ngatif pour ne rien vrifier.
+    void SetFixedStepAllocBudget(int maxCount);
+
+    /// @brief Renvoie l'arne des donnes temporaires de la frame,
+    /// vide au dbut de chaque Update(). Elle n'est utilisable que depuis
+    /// le thread principal, en dehors des pas fixes.
+    FrameArena &GetFrameArena();
+
+    /// @brief Renvoie l'arne des donnes temporaires du pas fixe,
+    /// vide au dbut de chaque pas. Elle n'est utilisable que depuis
+    /// FixedUpdate(), et pas depuis ParallelFixedUpdate().
+    FrameArena &GetStepArena();
+
+    /// @brief Renvoie la roue des minuteries avanant avec le temps de la scne.
+    /// Les fonctions des minuteries sont appeles avant les Update().
+    TimerWheel &GetTimers();
+
+    /// @brief Renvoie la roue des minuteries avanant d'un tick  chaque pas fixe.
+    /// Les fonctions des minuteries sont appeles au dbut du pas, sur le thread
+    /// principal. La roue ne doit pas tre lue depuis ParallelFixedUpdate().
+    TimerWheel &GetFixedTimers();
+
+    /// @brief Renvoie le pool des objets de type T, cr au premier appel.
+    /// Les pools sont dtruits avec la scne, aprs ses objets.
+    template <class T>
+    ObjectPool<T> &GetObjectPool();
+
 protected:
     friend class GameObject;
 
@@ -255,11 +395,29 @@ protected:
 
     UICanvas *m_canvas;
 
-    /// @brief Pas de temps fixe.
+    /// @brief Nombre de pas fixes par seconde.
+    Uint64 m_fixedStepRate;
+
+    /// @brief Pas de temps fixe, arrondi  la milliseconde.
     Uint64 m_timeStepMS;
 
-    /// @brief Accumulateur pour la mise  jour  pas de temps fixe.
-    Uint64 m_stepAccuMS;
+    /// @brief Accumulateur pour la mise  jour  pas de temps fixe,
+    /// en ticks du chronomtre multiplis par le nombre de pas par seconde.
+    Uint64 m_stepAccu;
+
+    /// @brief Temps simul par les pas fixes.
+    Uint64 m_fixedElapsedMS;
+    Uint64 m_fixedElapsedRem;
+
+    /// @brief Dure maximale des pas fixes d'une frame (en millisecondes).
+    float m_fixedStepBudgetMS;
+    int m_maxFixedStepCount;
+
+    /// @brief Moyenne glissante de la dure d'un pas fixe (en millisecondes).
+    float m_fixedStepCostMS;
+
+    /// @brief Nombre de frames restant avant la fin de la surcharge.
+    int m_overloadFrames;
 
     Uint64 m_updateID;
 
@@ -280,13 +438,49 @@ protected:
     /// @brief Boolen indiquant s'il faut quitter la scne.
     bool m_quit;
 
+    /// @brief Systme de jobs utilis par la phase ParallelFixedUpdate().
+    JobSystem m_jobSystem;
+
+    /// @brief Volumes de dclenchement tests  chaque pas fixe.
+    TriggerSystem m_triggerSystem;
+
+    /// @brief Etat de lecture des animations des horloges SCENE et UNSCALED.
+    AnimationSystem m_animationSystem;
+
+    /// @brief Etat de lecture des animations de l'horloge FIXED.
+    /// Ce systme distinct n'est parcouru que par les pas fixes, qui ne
+    /// visitent donc que leurs animations et ne partagent pas de tableaux
+    /// avec les animations cres ou dtruites pendant la frame.
+    AnimationSystem m_fixedAnimationSystem;
+
     Gizmos m_gizmos;
 
     SceneContactListener m_contactListener;
 
+    SceneStats m_stats;
+
+    int m_fixedStepAllocBudget;
+
+    /// @brief Arne vide au dbut de chaque Update().
+    FrameArena m_frameArena;
+
+    /// @brief Arne vide au dbut de chaque pas fixe.
+    /// Elle est distincte de l'arne de la frame car une frame peut compter
+    /// zro ou plusieurs pas fixes. Ses donnes restent valides jusqu'au
+    /// pas fixe suivant, donc pendant le Render() de la frame.
+    FrameArena m_stepArena;
+
+    TimerWheel m_timers;
+    TimerWheel m_fixedTimers;
+
 private:
     void UpdateGameObjects();
-    void MakeFixedStep();
+    void UpdateObjects();
+    int UpdateTime();
+    int ApplyFixedStepBudget(int stepCount);
+    void MakeFixedSteps(int stepCount);
+    void MakeFixedStep(int stepIndex);
+    void MakeParallelFixedUpdate();
     void PushQueryGizmos(Color color, b2Vec2 point1, b2Vec2 point2);
     void PushQueryGizmos(Color color, b2Fixture *fixture);
     void PushQueryGizmos(Color color, const b2AABB &aabb);
@@ -294,8 +488,20 @@ private:
 
     bool m_inFixedUpdate;
 
-    std::set<QueryGizmos *> m_queryGizmos;
+    /// @brief Formes des requtes du dernier pas fixe, alloues dans m_stepArena.
+    ArenaVector<QueryGizmos> m_queryGizmos;
     std::map<int, ParticleSystem *> m_particleSystemMap;
+
+    /// @brief Objets de la phase parallle, tris par cl d'criture.
+    std::vector<GameObject *> m_parallelObjects;
+
+    /// @brief Indices de dbut de chaque groupe dans m_parallelObjects.
+    std::vector<int> m_parallelGroups;
+
+    /// @brief Contextes de la phase parallle (un par groupe).
+    std::vector<FixedUpdateContext> m_parallelContexts;
+
+    std::map<std::type_index, ObjectPoolBase *> m_objectPools;
 };
 
 inline SceneManager *Scene::GetSceneManager()
@@ -365,7 +571,7 @@ inline const Uint64 Scene::GetElapsedMS() const
 
 inline const float Scene::GetDelta() const
 {
-    return m_inFixedUpdate ? ((float)m_timeStepMS / 1000.f) : m_time.GetDelta();
+    return m_inFixedUpdate ? GetFixedTimeStep() : m_time.GetDelta();
 }
 
 inline const Uint64 Scene::GetDeltaMS() const
@@ -373,6 +579,26 @@ inline const Uint64 Scene::GetDeltaMS() const
     return m_inFixedUpdate ? m_timeStepMS : m_time.GetDeltaMS();
 }
 
+inline const float Scene::GetFixedElapsed() const
+{
+    return (float)m_fixedElapsedMS / 1000.f;
+}
+
+inline int Scene::GetFixedStepRate() const
+{
+    return (int)m_fixedStepRate;
+}
+
+inline float Scene::GetFixedTimeStep() const
+{
+    return 1.f / (float)m_fixedStepRate;
+}
+
+inline const Uint64 Scene::GetFixedElapsedMS() const
+{
+    return m_fixedElapsedMS;
+}
+
 inline Scene::UpdateMode Scene::GetUpdateMode() const
 {
     return m_mode;
@@ -428,12 +654,74 @@ inline Uint64 Scene::GetUpdateID() const
     return m_updateID;
 }
 
-struct QueryGizmos
+inline JobSystem &Scene::GetJobSystem()
 {
-    QueryGizmos(Color color, GizmosShape shape) :
-        m_color(color), m_shape(shape) { }
+    return m_jobSystem;
+}
 
-    Color m_color;
-    GizmosShape m_shape;
-};
+inline TriggerSystem &Scene::GetTriggerSystem()
+{
+    return m_triggerSystem;
+}
+
+inline AnimationSystem *Scene::GetAnimationSystem(AnimClock clock)
+{
+    return (clock == AnimClock::FIXED) ? &m_fixedAnimationSystem : &m_animationSystem;
+}
+
+inline const SceneStats &Scene::GetStats() const
+{
+    return m_stats;
+}
+
+inline void Scene::SetFixedStepBudget(float budgetMS, int maxStepCount)
+{
+    m_fixedStepBudgetMS = budgetMS;
+    m_maxFixedStepCount = std::max(maxStepCount, 1);
+}
+
+inline bool Scene::IsFixedStepOverloaded() const
+{
+    return m_overloadFrames > 0;
+}
+
+inline void Scene::SetFixedStepAllocBudget(int maxCount)
+{
+    m_fixedStepAllocBudget = maxCount;
+}
+
+inline FrameArena &Scene::GetFrameArena()
+{
+    return m_frameArena;
+}
+
+inline FrameArena &Scene::GetStepArena()
+{
+    return m_stepArena;
+}
+
+inline TimerWheel &Scene::GetTimers()
+{
+    return m_timers;
+}
+
+inline TimerWheel &Scene::GetFixedTimers()
+{
+    return m_fixedTimers;
+}
+
+template <class T>
+inline ObjectPool<T> &Scene::GetObjectPool()
+{
+    auto it = m_objectPools.find(std::type_index(typeid(T)));
+    if (it != m_objectPools.end())
+    {
+        return *static_cast<ObjectPool<T> *>(it->second);
+    }
+
+    ObjectPool<T> *pool = new ObjectPool<T>(this);
+    AssertNew(pool);
+    m_objectPools[std::type_index(typeid(T))] = pool;
+    return *pool;
+}
 
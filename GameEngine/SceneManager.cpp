@@ -19,7 +19,6 @@ SceneManager::SceneManager(InputManager *inputManager) :
     UIFadeDef fadeDef;
     fadeDef.fadeOpacity = true;
     fadeDef.duration = 1.0f;
-    fadeDef.easing = EasingFct_Out;
     m_fillFader->SetFadeInAnimation(fadeDef);
     m_fillFader->SetFadeOutAnimation(fadeDef);
 
@@ -13,11 +13,7 @@
 class SpriteAnim : public Animation
 {
 public:
-    SpriteAnim(const std::string &name, SpriteGroup *spriteGroup);
-
-    virtual void Play() override;
-    virtual void Update(float dt) override;
-    virtual void SetCycleTime(float cycleTime) override;
+    SpriteAnim(AnimationSystem *system, const std::string &name, SpriteGroup *spriteGroup);
 
     void SetFPS(float fps);
     int GetSpriteCount() const;
@@ -30,18 +26,8 @@ public:
 
 protected:
     SpriteGroup *m_spriteGroup;
-    std::vector<float> m_frameTimes;
-    int m_frameID;
-
-    void ComputeFrameTimes();
 };
 
-inline void SpriteAnim::SetCycleTime(float cycleTime)
-{
-    Animation::SetCycleTime(cycleTime);
-    ComputeFrameTimes();
-}
-
 inline int SpriteAnim::GetSpriteCount() const
 {
     return m_spriteGroup->GetSpriteCount();
@@ -59,12 +45,12 @@ inline SDL_Texture *SpriteAnim::GetTexture() const
 
 inline const SDL_Rect *SpriteAnim::GetSourceRect() const
 {
-    return m_spriteGroup->GetSourceRect(m_frameID);
+    return m_spriteGroup->GetSourceRect(GetFrameID());
 }
 
 inline int SpriteAnim::GetFrameID() const
 {
-    return m_frameID;
+    return m_system->m_frameIDs[m_index];
 }
 
 inline void SpriteAnim::SetFPS(float fps)
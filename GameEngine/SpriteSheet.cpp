@@ -7,6 +7,7 @@
 #include "SpriteSheet.h"
 #include "Settings.h"
 #include "AssetManager.h"
+#include "Utils.h"
 #include <cstdio>
 
 void Memcpy(
@@ -119,6 +120,14 @@ void SpriteSheet::LoadPart(cJSON *jPart, int i)
             i++;
         }
     }
+
+    // Dures relatives des images (optionnelles)
+    // Exemple : "durations": [ 2, 1, 1, 4 ]
+    jTmp = cJSON_GetObjectItem(jPart, "durations");
+    if (cJSON_IsArray(jTmp) && cJSON_GetArraySize(jTmp) == part->m_spriteCount)
+    {
+        part->LoadDurations(jTmp);
+    }
 }
 
 void SpriteSheet::LoadGeometry(cJSON *jGeo)
@@ -238,17 +247,16 @@ char *SpriteSheet::ParseJSON(cJSON *json)
     return fname;
 }
 
-SpriteSheet::SpriteSheet(SDL_Renderer *renderer, const std::string &path) :
-    m_renderer(renderer)
+bool SpriteSheet::ParseFile(const std::string &path)
 {
     // Lit le fichier et rcupre le contenu dans un buffer
     FILE *file = fopen(path.c_str(), "rb");
-    AssertNew(file);
+    if (file == NULL) return false;
 
     fseek(file, 0, SEEK_END);
     long fileSize = ftell(file);
 
-    char *buffer = (char *)calloc(fileSize, sizeof(char));
+    char *buffer = (char *)calloc(fileSize + 1, sizeof(char));
     AssertNew(buffer);
 
     rewind(file);
@@ -258,35 +266,165 @@ SpriteSheet::SpriteSheet(SDL_Renderer *renderer, const std::string &path) :
 
     // Parse le buffer et cre une structure json
     cJSON *json = cJSON_ParseWithLength(buffer, fileSize);
-    AssertNew(json);
+    if (json == NULL)
+    {
+        free(buffer);
+        return false;
+    }
 
     // Parse la structure json
     char *fname = ParseJSON(json);
+    if (fname != NULL)
+    {
+        char *dir = Parser_GetDir(path.c_str());
+        char *texPath = Parser_MakePath(dir, fname);
+        m_texturePath.assign(texPath);
+        free(texPath);
+        free(dir);
+    }
+    m_path = path;
 
-    char *dir = Parser_GetDir(path.c_str());
-    char *texPath = Parser_MakePath(dir, fname);
+    // Libre la mmoire temporaire
+    cJSON_Delete(json);
+    free(buffer);
+
+    return (fname != NULL) && (m_rects != NULL);
+}
+
+SpriteSheet::SpriteSheet() :
+    m_renderer(nullptr), m_texture(nullptr), m_groups(nullptr), m_groupCount(0),
+    m_rects(nullptr), m_rectCount(0), m_path(), m_texturePath(), m_surface(nullptr)
+{
+}
+
+SpriteSheet::SpriteSheet(SDL_Renderer *renderer, const std::string &path) :
+    m_renderer(renderer), m_texture(nullptr), m_groups(nullptr), m_groupCount(0),
+    m_rects(nullptr), m_rectCount(0), m_path(), m_texturePath(), m_surface(nullptr)
+{
+    if (ParseFile(path) == false)
+    {
+        printf("ERROR - Loading sprite sheet %s\n", path.c_str());
+        assert(false);
+        abort();
+    }
 
     void *rwopsBuffer = NULL;
     SDL_RWops *rwops = NULL;
-    AssetManager::CreateRWops(std::string(texPath), &rwops, &rwopsBuffer);
+    AssetManager::CreateRWops(m_texturePath, &rwops, &rwopsBuffer);
 
     SDL_Texture *texture = IMG_LoadTexture_RW(renderer, rwops, 0);
     if (!texture)
     {
-        printf("ERROR - Loading texture %s\n", texPath);
+        printf("ERROR - Loading texture %s\n", m_texturePath.c_str());
         printf("      - %s\n", SDL_GetError());
         assert(false);
         abort();
     }
     m_texture = texture;
-    free(texPath);
-    free(dir);
 
     AssetManager::DestroyRWops(rwops, rwopsBuffer);
+}
 
-    // Libre la mmoire temporaire
-    cJSON_Delete(json);
-    free(buffer);
+SpriteSheet *SpriteSheet::LoadStaging(const std::string &path)
+{
+    SpriteSheet *staging = new SpriteSheet();
+    AssertNew(staging);
+
+    if (staging->ParseFile(path) == false)
+    {
+        printf("ERROR - Reloading sprite sheet %s\n", path.c_str());
+        delete staging;
+        return nullptr;
+    }
+
+    // Le fichier peut tre en cours d'criture par un autre programme
+    FILE *file = fopen(staging->m_texturePath.c_str(), "rb");
+    if (file == NULL)
+    {
+        printf("ERROR - Reloading texture %s\n", staging->m_texturePath.c_str());
+        delete staging;
+        return nullptr;
+    }
+    fclose(file);
+
+    void *rwopsBuffer = NULL;
+    SDL_RWops *rwops = NULL;
+    AssetManager::CreateRWops(staging->m_texturePath, &rwops, &rwopsBuffer);
+
+    staging->m_surface = IMG_Load_RW(rwops, 0);
+    AssetManager::DestroyRWops(rwops, rwopsBuffer);
+
+    if (staging->m_surface == NULL)
+    {
+        printf("ERROR - Reloading texture %s\n", staging->m_texturePath.c_str());
+        printf("      - %s\n", IMG_GetError());
+        delete staging;
+        return nullptr;
+    }
+
+    return staging;
+}
+
+int SpriteSheet::SwapContents(SpriteSheet &staging)
+{
+    assert(staging.m_surface);
+
+    SDL_Texture *texture = SDL_CreateTextureFromSurface(m_renderer, staging.m_surface);
+    if (texture == NULL)
+    {
+        printf("ERROR - Reloading texture %s\n", staging.m_texturePath.c_str());
+        printf("      - %s\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    if (m_texture) SDL_DestroyTexture(m_texture);
+    m_texture = texture;
+    m_texturePath = staging.m_texturePath;
+
+    std::swap(m_rects, staging.m_rects);
+    std::swap(m_rectCount, staging.m_rectCount);
+
+    // Met  jour sur place les groupes existants et ajoute les nouveaux groupes
+    for (int i = 0; i < staging.m_groupCount; ++i)
+    {
+        SpriteGroup *newGroup = staging.m_groups[i];
+        if (newGroup->m_spriteCount <= 0) continue;
+
+        SpriteGroup *group = GetGroup(newGroup->m_name);
+        if (group == nullptr)
+        {
+            SpriteGroup **groups = (SpriteGroup **)realloc(
+                m_groups, (m_groupCount + 1) * sizeof(SpriteGroup *)
+            );
+            AssertNew(groups);
+            m_groups = groups;
+
+            group = new SpriteGroup(*this);
+            group->m_name = newGroup->m_name;
+            m_groups[m_groupCount++] = group;
+        }
+
+        std::swap(group->m_spriteIndices, newGroup->m_spriteIndices);
+        std::swap(group->m_spriteCount, newGroup->m_spriteCount);
+        std::swap(group->m_frameStarts, newGroup->m_frameStarts);
+    }
+
+    // Les groupes absents de la nouvelle description sont conservs,
+    // leurs indices sont ramens dans les bornes
+    for (int i = 0; i < m_groupCount; ++i)
+    {
+        SpriteGroup *group = m_groups[i];
+        for (int j = 0; j < group->m_spriteCount; ++j)
+        {
+            int &rectIndex = group->m_spriteIndices[j];
+            rectIndex = Math::Clamp(rectIndex, 0, m_rectCount - 1);
+        }
+    }
+
+    SDL_FreeSurface(staging.m_surface);
+    staging.m_surface = nullptr;
+
+    return EXIT_SUCCESS;
 }
 
 SpriteSheet::~SpriteSheet()
@@ -295,6 +433,10 @@ SpriteSheet::~SpriteSheet()
     {
         SDL_DestroyTexture(m_texture);
     }
+    if (m_surface)
+    {
+        SDL_FreeSurface(m_surface);
+    }
 
     if (m_groups)
     {
@@ -338,10 +480,51 @@ const std::string &SpriteGroup::GetName() const
 }
 
 SpriteGroup::SpriteGroup(SpriteSheet &spriteSheet) :
-    m_spriteSheet(spriteSheet), m_spriteCount(0), m_spriteIndices(nullptr), m_name("")
+    m_spriteSheet(spriteSheet), m_spriteCount(0), m_spriteIndices(nullptr),
+    m_frameStarts(nullptr), m_name("")
 {}
 
 SpriteGroup::~SpriteGroup()
 {
     if (m_spriteIndices) free(m_spriteIndices);
+    if (m_frameStarts) free(m_frameStarts);
+}
+
+void SpriteGroup::LoadDurations(cJSON *jDurations)
+{
+    const int frameCount = m_spriteCount;
+    float *frameStarts = (float *)calloc(frameCount + 1, sizeof(float));
+    AssertNew(frameStarts);
+
+    // Sommes prfixes des dures
+    bool uniform = true;
+    float firstDuration = -1.f;
+    int i = 0;
+    cJSON *jDuration = NULL;
+    cJSON_ArrayForEach(jDuration, jDurations)
+    {
+        float duration = cJSON_IsNumber(jDuration) ? (float)jDuration->valuedouble : 1.f;
+        duration = fmaxf(duration, 0.f);
+        if (firstDuration < 0.f) firstDuration = duration;
+        uniform = uniform && (duration == firstDuration);
+
+        frameStarts[i + 1] = frameStarts[i] + duration;
+        i++;
+    }
+
+    const float totalDuration = frameStarts[frameCount];
+    if (uniform || totalDuration <= 0.f)
+    {
+        // La table n'est pas ncessaire
+        free(frameStarts);
+        return;
+    }
+
+    for (i = 0; i < frameCount; i++)
+    {
+        frameStarts[i] /= totalDuration;
+    }
+
+    if (m_frameStarts) free(m_frameStarts);
+    m_frameStarts = frameStarts;
 }
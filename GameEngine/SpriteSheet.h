@@ -33,16 +33,35 @@ public:
     const SDL_Rect *GetSourceRect(int spriteIdx);
     const std::string &GetName() const;
 
+    /// @brief Renvoie l'image affichée à une position du cycle d'animation.
+    /// La table des durées est propre au groupe et partagée par toutes
+    /// ses animations : la recherche est directe si les images ont la même
+    /// durée, dichotomique sinon.
+    /// @param ratio la position dans le cycle, entre 0.f et 1.f.
+    /// @return L'indice de l'image.
+    int GetFrameAt(float ratio) const;
+
+    /// @brief Indique si les images du groupe ont toutes la même durée.
+    bool HasUniformTiming() const;
+
 protected:
     friend class SpriteSheet;
 
     SpriteGroup(SpriteSheet &spriteSheet);
 
+    /// @brief Construit la table des débuts d'images à partir des durées
+    /// relatives lues dans le fichier de la feuille.
+    void LoadDurations(cJSON *jDurations);
+
     SpriteSheet &m_spriteSheet;
     std::string m_name;
     int *m_spriteIndices;
     int m_spriteCount;
 
+    /// @brief Début de chaque image dans le cycle, entre 0.f et 1.f.
+    /// Vaut nullptr si les images ont toutes la même durée.
+    float *m_frameStarts;
+
 private:
 };
 
@@ -64,6 +83,25 @@ public:
     int GetSourceRectCount() const;
     const SDL_Rect *GetSourceRect(int index) const;
 
+    const std::string &GetPath() const;
+    const std::string &GetTexturePath() const;
+
+    /// @brief Lit une feuille depuis le disque sans créer sa texture.
+    /// Cette méthode peut être appelée depuis un thread secondaire
+    /// et ne termine pas le programme en cas d'erreur.
+    /// @param path le chemin de la description JSON de la feuille.
+    /// @return La feuille intermédiaire à passer à SwapContents(),
+    /// ou nullptr si le fichier est absent ou invalide.
+    static SpriteSheet *LoadStaging(const std::string &path);
+
+    /// @brief Remplace le contenu de la feuille par celui d'une feuille
+    /// intermédiaire. Les groupes sont associés par leur nom et mis à jour
+    /// sur place : les pointeurs SpriteGroup* restent valides.
+    /// Cette méthode doit être appelée sur le thread de rendu.
+    /// @param staging la feuille obtenue avec LoadStaging(), vidée par l'appel.
+    /// @return EXIT_SUCCESS ou EXIT_FAILURE si la texture n'a pas pu être créée.
+    int SwapContents(SpriteSheet &staging);
+
 protected:
 
     friend class SpriteGroup;
@@ -77,8 +115,17 @@ protected:
     SDL_Rect *m_rects;
     int m_rectCount;
 
+    std::string m_path;
+    std::string m_texturePath;
+
+    /// @brief Image d'une feuille intermédiaire, convertie en texture par SwapContents().
+    SDL_Surface *m_surface;
+
 private:
 
+    SpriteSheet();
+
+    bool ParseFile(const std::string &path);
     void LoadRect(cJSON *jRect, int i);
     void LoadPart(cJSON *jPart, int i);
     void LoadGeometry(cJSON *jGeo);
@@ -141,6 +188,26 @@ inline const SDL_Rect *SpriteGroup::GetSourceRect(int i)
     return &(m_spriteSheet.m_rects[rectIndex]);
 }
 
+inline int SpriteGroup::GetFrameAt(float ratio) const
+{
+    int frameID = 0;
+    if (m_frameStarts == nullptr)
+    {
+        frameID = (int)(ratio * (float)m_spriteCount);
+    }
+    else
+    {
+        const float *it = std::upper_bound(m_frameStarts, m_frameStarts + m_spriteCount, ratio);
+        frameID = (int)(it - m_frameStarts) - 1;
+    }
+    return std::max(0, std::min(frameID, m_spriteCount - 1));
+}
+
+inline bool SpriteGroup::HasUniformTiming() const
+{
+    return m_frameStarts == nullptr;
+}
+
 inline SDL_Texture *SpriteSheet::GetTexture()
 {
     return m_texture;
@@ -156,3 +223,13 @@ inline const SDL_Rect * SpriteSheet::GetSourceRect(int index) const
     assert(0 <= index && index < m_rectCount);
     return &(m_rects[index]);
 }
+
+inline const std::string &SpriteSheet::GetPath() const
+{
+    return m_path;
+}
+
+inline const std::string &SpriteSheet::GetTexturePath() const
+{
+    return m_texturePath;
+}
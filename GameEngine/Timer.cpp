@@ -8,54 +8,106 @@
 
 Timer::Timer()
 {
+    m_frequency = SDL_GetPerformanceFrequency();
+    if (m_frequency == 0) m_frequency = 1000;
+
     m_startTime = 0;
     m_currentTime = 0;
     m_previousTime = 0;
 
     m_delta = 0;
     m_unscaledDelta = 0;
+    m_deltaMS = 0;
+    m_unscaledDeltaMS = 0;
     m_elapsed = 0;
     m_unscaledElapsed = 0;
 
-    m_maxDelta = 100;
-    m_scale = 1.0;
+    m_scaleNum = TIMER_SCALE_ONE;
+    m_scaleDen = TIMER_SCALE_ONE;
+    m_scaleRemainder = 0;
+
+    m_smoothing = true;
+    m_averageDelta = 0;
+    m_smoothingDebt = 0;
+
+    m_maxDelta = MSToTicks(100);
 }
 
 void Timer::Start()
 {
-    m_currentTime = SDL_GetTicks64();
-    m_previousTime = SDL_GetTicks64();
+    m_startTime = SDL_GetPerformanceCounter();
+    m_currentTime = m_startTime;
+    m_previousTime = m_startTime;
     m_delta = 0;
+    m_unscaledDelta = 0;
+    m_deltaMS = 0;
+    m_unscaledDeltaMS = 0;
+    m_averageDelta = 0;
+    m_smoothingDebt = 0;
 }
 
 void Timer::Update()
 {
     m_previousTime = m_currentTime;
-    m_currentTime = SDL_GetTicks64();
+    m_currentTime = SDL_GetPerformanceCounter();
 
-    m_unscaledDelta = m_currentTime - m_previousTime;
-    if (m_unscaledDelta > m_maxDelta)
+    Uint64 rawDelta = m_currentTime - m_previousTime;
+    if (rawDelta > m_maxDelta)
     {
-        m_unscaledDelta = m_maxDelta;
+        rawDelta = m_maxDelta;
     }
-    m_delta = (Uint64)(m_scale * (double)m_unscaledDelta);
-
-    m_unscaledElapsed += m_unscaledDelta;
-    m_elapsed += m_delta;
+    Advance(m_smoothing ? SmoothDelta(rawDelta) : rawDelta);
 }
 
 void Timer::Update(Uint64 deltaTimeMS)
 {
-    m_unscaledDelta = deltaTimeMS;
-    if (m_unscaledDelta > m_maxDelta)
+    Advance(MSToTicks(deltaTimeMS));
+}
+
+Uint64 Timer::SmoothDelta(Uint64 rawDelta)
+{
+    const Sint64 raw = (Sint64)rawDelta;
+    const Sint64 average = (Sint64)m_averageDelta;
+    Sint64 delta = 0;
+
+    if (m_averageDelta == 0 || 4 * std::abs(raw - average) > average)
     {
-        m_unscaledDelta = m_maxDelta;
+        // A-coup ou changement de fréquence : pas de lissage
+        // et le temps en attente est restitué en une fois
+        m_averageDelta = rawDelta;
+        delta = std::max((Sint64)0, raw + m_smoothingDebt);
+        m_smoothingDebt += raw - delta;
+        return (Uint64)delta;
     }
-    m_delta = (Uint64)(m_scale * (double)m_unscaledDelta);
 
-    m_previousTime = m_currentTime;
-    m_currentTime += m_delta;
+    // Variation normale : l'écart à la moyenne est restitué progressivement
+    m_averageDelta = (7 * m_averageDelta + rawDelta) / 8;
+    const Sint64 debt = m_smoothingDebt + raw - (Sint64)m_averageDelta;
+    delta = (Sint64)m_averageDelta + debt / 8;
+    m_smoothingDebt = debt - debt / 8;
+
+    return (Uint64)delta;
+}
+
+void Timer::Advance(Uint64 unscaledDelta)
+{
+    if (unscaledDelta > m_maxDelta)
+    {
+        unscaledDelta = m_maxDelta;
+    }
+
+    // Echelle de temps exacte, le reste est reporté au pas suivant
+    const Uint64 scaled = unscaledDelta * m_scaleNum + m_scaleRemainder;
+    m_unscaledDelta = unscaledDelta;
+    m_delta = scaled / m_scaleDen;
+    m_scaleRemainder = scaled % m_scaleDen;
+
+    const Uint64 prevElapsedMS = GetElapsedMS();
+    const Uint64 prevUnscaledElapsedMS = GetUnscaledElapsedMS();
 
     m_unscaledElapsed += m_unscaledDelta;
     m_elapsed += m_delta;
+
+    m_deltaMS = GetElapsedMS() - prevElapsedMS;
+    m_unscaledDeltaMS = GetUnscaledElapsedMS() - prevUnscaledElapsedMS;
 }
@@ -10,6 +10,9 @@
 
 /// @ingroup Timer
 /// @brief Structure représentant un chronomètre.
+/// Le temps est compté en ticks du compteur haute résolution
+/// (SDL_GetPerformanceCounter()) et l'échelle de temps est une fraction
+/// exacte : aucun temps n'est perdu par arrondi, même au ralenti.
 class Timer
 {
 public:
@@ -23,7 +26,23 @@ public:
     void Update(Uint64 deltaTimeMS);
 
     void SetMaximumDeltaTime(float maxDelta);
+
+    /// @brief Définit l'échelle de temps.
+    /// Elle est convertie en une fraction de dénominateur TIMER_SCALE_ONE.
+    /// @param scale l'échelle de temps (positive).
     void SetTimeScale(float scale);
+
+    /// @brief Définit l'échelle de temps comme une fraction exacte.
+    /// @param numerator le numérateur.
+    /// @param denominator le dénominateur (non nul).
+    void SetTimeScale(Uint32 numerator, Uint32 denominator);
+
+    /// @brief Active le lissage du pas de temps mesuré par Update().
+    /// Les petites variations de durée des frames sont absorbées
+    /// et restituées progressivement, sans dérive du temps total.
+    /// Les à-coups sont transmis tels quels.
+    void SetDeltaSmoothing(bool smoothing);
+
     float GetTimeScale() const;
     float GetDelta() const;
     float GetUnscaledDelta() const;
@@ -35,7 +54,24 @@ public:
     Uint64 GetElapsedMS() const;
     Uint64 GetUnscaledElapsedMS() const;
 
+    /// @brief Renvoie le nombre de ticks par seconde.
+    Uint64 GetFrequency() const;
+    Uint64 GetDeltaTicks() const;
+    Uint64 GetUnscaledDeltaTicks() const;
+    Uint64 GetElapsedTicks() const;
+    Uint64 GetUnscaledElapsedTicks() const;
+
+    Uint64 TicksToMS(Uint64 ticks) const;
+    Uint64 MSToTicks(Uint64 ms) const;
+
 protected:
+    void Advance(Uint64 unscaledDelta);
+    Uint64 SmoothDelta(Uint64 rawDelta);
+
+    /// @protected
+    /// @brief Nombre de ticks par seconde.
+    Uint64 m_frequency;
+
     /// @protected
     /// @brief Temps de départ.
     Uint64 m_startTime;
@@ -49,74 +85,153 @@ protected:
     Uint64 m_previousTime;
 
     /// @protected
-    /// @brief Ecart entre les deux derniers appels à Timer_Update().
+    /// @brief Ecart entre les deux derniers appels à Timer_Update() (en ticks).
     Uint64 m_delta;
     Uint64 m_unscaledDelta;
 
-    float m_scale;
+    /// @protected
+    /// @brief Ecarts en millisecondes, calculés à partir des temps écoulés
+    /// pour que leur somme soit égale au temps écoulé.
+    Uint64 m_deltaMS;
+    Uint64 m_unscaledDeltaMS;
+
+    /// @protected
+    /// @brief Echelle de temps sous forme de fraction.
+    Uint64 m_scaleNum;
+    Uint64 m_scaleDen;
+
+    /// @protected
+    /// @brief Reste de la division par m_scaleDen, reporté au pas suivant.
+    Uint64 m_scaleRemainder;
 
     Uint64 m_maxDelta;
 
     Uint64 m_elapsed;
     Uint64 m_unscaledElapsed;
+
+    bool m_smoothing;
+
+    /// @protected
+    /// @brief Moyenne glissante des écarts mesurés (en ticks).
+    Uint64 m_averageDelta;
+
+    /// @protected
+    /// @brief Temps mesuré qui n'a pas encore été restitué par le lissage.
+    Sint64 m_smoothingDebt;
 };
 
+/// @brief Dénominateur de l'échelle de temps définie par un flottant.
+#define TIMER_SCALE_ONE 65536
+
 inline void Timer::SetMaximumDeltaTime(float maxDelta)
 {
-    m_maxDelta = (Uint64)(maxDelta * 1000.f);
+    m_maxDelta = (Uint64)((double)maxDelta * (double)m_frequency);
 }
 
 inline void Timer::SetTimeScale(float scale)
 {
-    m_scale = scale;
+    scale = fmaxf(scale, 0.f);
+    SetTimeScale((Uint32)lround((double)scale * TIMER_SCALE_ONE), TIMER_SCALE_ONE);
+}
+
+inline void Timer::SetTimeScale(Uint32 numerator, Uint32 denominator)
+{
+    assert(denominator > 0);
+    if (m_scaleDen != denominator)
+    {
+        m_scaleRemainder = 0;
+    }
+    m_scaleNum = numerator;
+    m_scaleDen = denominator;
+}
+
+inline void Timer::SetDeltaSmoothing(bool smoothing)
+{
+    m_smoothing = smoothing;
 }
 
 inline float Timer::GetDelta() const
 {
-    return (float)m_delta / 1000.f;
+    return (float)((double)m_delta / (double)m_frequency);
 }
 
 inline float Timer::GetTimeScale() const
 {
-    return m_scale;
+    return (float)((double)m_scaleNum / (double)m_scaleDen);
 };
 
 inline float Timer::GetUnscaledDelta() const
 {
-    return (float)m_unscaledDelta / 1000.f;
+    return (float)((double)m_unscaledDelta / (double)m_frequency);
 }
 
 inline float Timer::GetElapsed() const
 {
-    return (float)m_elapsed / 1000.f;
+    return (float)((double)m_elapsed / (double)m_frequency);
 }
 
 inline float Timer::GetUnscaledElapsed() const
 {
-    return (float)m_unscaledElapsed / 1000.f;
+    return (float)((double)m_unscaledElapsed / (double)m_frequency);
 }
 
 inline Uint64 Timer::GetDeltaMS() const
 {
-    return m_delta;
+    return m_deltaMS;
 }
 
 inline Uint64 Timer::GetUnscaledDeltaMS() const
 {
-    return m_unscaledElapsed;
+    return m_unscaledDeltaMS;
 }
 
 inline Uint64 Timer::GetElapsedMS() const
 {
-    return m_elapsed;
+    return TicksToMS(m_elapsed);
 }
 
 inline Uint64 Timer::GetUnscaledElapsedMS() const
+{
+    return TicksToMS(m_unscaledElapsed);
+}
+
+inline Uint64 Timer::GetFrequency() const
+{
+    return m_frequency;
+}
+
+inline Uint64 Timer::GetDeltaTicks() const
+{
+    return m_delta;
+}
+
+inline Uint64 Timer::GetUnscaledDeltaTicks() const
+{
+    return m_unscaledDelta;
+}
+
+inline Uint64 Timer::GetElapsedTicks() const
+{
+    return m_elapsed;
+}
+
+inline Uint64 Timer::GetUnscaledElapsedTicks() const
 {
     return m_unscaledElapsed;
 }
 
+inline Uint64 Timer::TicksToMS(Uint64 ticks) const
+{
+    // Evite le dépassement de ticks * 1000
+    return (ticks / m_frequency) * 1000 + ((ticks % m_frequency) * 1000) / m_frequency;
+}
+
+inline Uint64 Timer::MSToTicks(Uint64 ms) const
+{
+    return (ms / 1000) * m_frequency + ((ms % 1000) * m_frequency) / 1000;
+}
+
 inline void Timer::Update(float deltaTime)
 {
-    Update((Uint64)(deltaTime * 1000.f));
+    Advance((Uint64)((double)fmaxf(deltaTime, 0.f) * (double)m_frequency));
 }
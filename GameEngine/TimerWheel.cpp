@@ -0,0 +1,203 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "TimerWheel.h"
+
+#define TIMER_WHEEL_MASK (TIMER_WHEEL_SLOT_COUNT - 1)
+
+TimerWheel::TimerWheel(float tickDuration) :
+    m_tickDuration(tickDuration), m_accumulator(0.f), m_currentTick(0),
+    m_pendingCount(0), m_nodes(), m_freeNodes(), m_heads()
+{
+    assert(tickDuration > 0.f);
+    m_heads.fill(-1);
+}
+
+TimerHandle TimerWheel::Schedule(float delay, const std::function<void()> &callback)
+{
+    // Délai arrondi au tick supérieur, en tolérant les erreurs d'arrondi
+    float tickCount = ceilf(delay / m_tickDuration - 1e-3f);
+    uint64_t ticks = (tickCount < 1.f) ? 1 : (uint64_t)tickCount;
+
+    int index = -1;
+    if (m_freeNodes.empty())
+    {
+        index = (int)m_nodes.size();
+        m_nodes.push_back(TimerNode());
+        m_nodes.back().generation = 0;
+    }
+    else
+    {
+        index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+
+    TimerNode &node = m_nodes[index];
+    node.callback = callback;
+    node.expireTick = m_currentTick + ticks;
+    node.slot = -1;
+    node.prev = -1;
+    node.next = -1;
+
+    Insert(index);
+    m_pendingCount++;
+
+    return TimerHandle(index, node.generation);
+}
+
+bool TimerWheel::Cancel(TimerHandle &handle)
+{
+    bool pending = IsPending(handle);
+    if (pending)
+    {
+        Unlink(handle.m_index);
+        Release(handle.m_index);
+    }
+    handle = TimerHandle();
+    return pending;
+}
+
+float TimerWheel::GetRemaining(const TimerHandle &handle) const
+{
+    const TimerNode *node = GetNode(handle);
+    if (node == nullptr) return -1.f;
+
+    float remaining = (float)(node->expireTick - m_currentTick) * m_tickDuration;
+    return std::max(0.f, remaining - m_accumulator);
+}
+
+void TimerWheel::Tick()
+{
+    m_currentTick++;
+
+    // Descend les minuteries des niveaux supérieurs quand un niveau a fait un tour
+    for (int level = 1; level < TIMER_WHEEL_LEVEL_COUNT; level++)
+    {
+        int shift = (level - 1) * TIMER_WHEEL_BITS;
+        if (((m_currentTick >> shift) & TIMER_WHEEL_MASK) != 0) break;
+
+        int slotIndex = (int)((m_currentTick >> (shift + TIMER_WHEEL_BITS)) & TIMER_WHEEL_MASK);
+        Cascade(level, slotIndex);
+    }
+
+    // Toutes les minuteries de la case courante du premier niveau ont expiré
+    int slot = (int)(m_currentTick & TIMER_WHEEL_MASK);
+    while (m_heads[slot] >= 0)
+    {
+        int index = m_heads[slot];
+        Unlink(index);
+
+        // La fonction peut programmer d'autres minuteries
+        std::function<void()> callback = std::move(m_nodes[index].callback);
+        Release(index);
+
+        if (callback) callback();
+    }
+}
+
+void TimerWheel::Advance(float elapsed)
+{
+    m_accumulator += elapsed;
+    while (m_accumulator >= m_tickDuration)
+    {
+        m_accumulator -= m_tickDuration;
+        Tick();
+    }
+}
+
+void TimerWheel::Insert(int index)
+{
+    TimerNode &node = m_nodes[index];
+    uint64_t expireTick = std::max(node.expireTick, m_currentTick);
+    uint64_t delta = expireTick - m_currentTick;
+
+    // Choisit le niveau dont la portée contient l'échéance
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVEL_COUNT - 1 &&
+        delta >= ((uint64_t)1 << ((level + 1) * TIMER_WHEEL_BITS)))
+    {
+        level++;
+    }
+
+    // Les échéances hors de portée sont rangées dans la dernière case atteignable,
+    // elles seront replacées lors de la descente
+    uint64_t maxDelta = ((uint64_t)1 << (TIMER_WHEEL_LEVEL_COUNT * TIMER_WHEEL_BITS)) - 1;
+    if (delta > maxDelta)
+    {
+        expireTick = m_currentTick + maxDelta;
+    }
+
+    int shift = level * TIMER_WHEEL_BITS;
+    int slotIndex = (int)((expireTick >> shift) & TIMER_WHEEL_MASK);
+    Link(index, level * TIMER_WHEEL_SLOT_COUNT + slotIndex);
+}
+
+void TimerWheel::Link(int index, int slot)
+{
+    TimerNode &node = m_nodes[index];
+    node.slot = slot;
+    node.prev = -1;
+    node.next = m_heads[slot];
+    if (node.next >= 0)
+    {
+        m_nodes[node.next].prev = index;
+    }
+    m_heads[slot] = index;
+}
+
+void TimerWheel::Unlink(int index)
+{
+    TimerNode &node = m_nodes[index];
+    assert(node.slot >= 0);
+
+    if (node.prev >= 0)
+        m_nodes[node.prev].next = node.next;
+    else
+        m_heads[node.slot] = node.next;
+
+    if (node.next >= 0)
+        m_nodes[node.next].prev = node.prev;
+
+    node.slot = -1;
+    node.prev = -1;
+    node.next = -1;
+}
+
+void TimerWheel::Release(int index)
+{
+    TimerNode &node = m_nodes[index];
+    node.callback = nullptr;
+    node.generation++;
+    m_freeNodes.push_back(index);
+    m_pendingCount--;
+}
+
+void TimerWheel::Cascade(int level, int slotIndex)
+{
+    int slot = level * TIMER_WHEEL_SLOT_COUNT + slotIndex;
+    int index = m_heads[slot];
+    m_heads[slot] = -1;
+
+    while (index >= 0)
+    {
+        int next = m_nodes[index].next;
+        m_nodes[index].slot = -1;
+        Insert(index);
+        index = next;
+    }
+}
+
+const TimerWheel::TimerNode *TimerWheel::GetNode(const TimerHandle &handle) const
+{
+    if (handle.m_index < 0 || handle.m_index >= (int)m_nodes.size())
+        return nullptr;
+
+    const TimerNode &node = m_nodes[handle.m_index];
+    if (node.generation != handle.m_generation || node.slot < 0)
+        return nullptr;
+
+    return &node;
+}
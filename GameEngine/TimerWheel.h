@@ -0,0 +1,152 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+#include <functional>
+
+#define TIMER_WHEEL_BITS 6
+#define TIMER_WHEEL_SLOT_COUNT (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVEL_COUNT 4
+
+/// @brief Identifiant d'une minuterie programmée dans une TimerWheel.
+/// Un identifiant devient invalide dès que sa minuterie expire
+/// ou est annulée, même si son emplacement est réutilisé.
+class TimerHandle
+{
+public:
+    TimerHandle();
+
+    /// @brief Booléen indiquant si l'identifiant a été obtenu par Schedule().
+    /// Utiliser TimerWheel::IsPending() pour savoir si la minuterie est active.
+    bool IsValid() const;
+
+private:
+    friend class TimerWheel;
+    TimerHandle(int index, uint32_t generation);
+
+    int m_index;
+    uint32_t m_generation;
+};
+
+/// @brief Roue de minuteries hiérarchique.
+/// Chaque minuterie est rangée dans une case selon son échéance,
+/// la programmation, l'annulation et l'expiration sont en O(1).
+/// Une minuterie n'est pas visitée avant son échéance, sauf lorsqu'elle
+/// descend d'un niveau de la roue (au plus TIMER_WHEEL_LEVEL_COUNT - 1 fois).
+/// Une roue ne doit être utilisée que par un seul thread.
+class TimerWheel
+{
+public:
+    /// @brief Construit une roue vide.
+    /// @param tickDuration la durée d'un tick (en secondes).
+    TimerWheel(float tickDuration);
+    TimerWheel(TimerWheel const&) = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+
+    /// @brief Programme une minuterie.
+    /// @param delay le délai avant l'expiration (en secondes),
+    /// arrondi au tick supérieur et d'au moins un tick.
+    /// @param callback la fonction appelée à l'expiration (peut être vide).
+    /// @return L'identifiant de la minuterie.
+    TimerHandle Schedule(float delay, const std::function<void()> &callback = nullptr);
+
+    /// @brief Annule une minuterie sans appeler sa fonction.
+    /// @param handle l'identifiant de la minuterie, invalidé par l'appel.
+    /// @return true si la minuterie était active.
+    bool Cancel(TimerHandle &handle);
+
+    /// @brief Booléen indiquant si la minuterie n'a pas encore expiré.
+    bool IsPending(const TimerHandle &handle) const;
+
+    /// @brief Renvoie le temps restant avant l'expiration d'une minuterie
+    /// (en secondes), ou -1 si elle n'est plus active.
+    float GetRemaining(const TimerHandle &handle) const;
+
+    /// @brief Fait avancer la roue d'un tick et appelle les fonctions
+    /// des minuteries expirées.
+    void Tick();
+
+    /// @brief Fait avancer la roue d'une durée.
+    /// Le reste inférieur à un tick est conservé pour l'appel suivant.
+    /// @param elapsed la durée écoulée (en secondes).
+    void Advance(float elapsed);
+
+    /// @brief Modifie la durée d'un tick.
+    /// Les minuteries déjà programmées conservent leur nombre de ticks.
+    void SetTickDuration(float tickDuration);
+    float GetTickDuration() const;
+    int GetPendingCount() const;
+
+private:
+    struct TimerNode
+    {
+        std::function<void()> callback;
+        uint64_t expireTick;
+        uint32_t generation;
+
+        /// @brief Case de la roue contenant la minuterie (-1 si libre).
+        int slot;
+        int prev;
+        int next;
+    };
+
+    void Insert(int index);
+    void Link(int index, int slot);
+    void Unlink(int index);
+    void Release(int index);
+    void Cascade(int level, int slotIndex);
+    const TimerNode *GetNode(const TimerHandle &handle) const;
+
+    float m_tickDuration;
+    float m_accumulator;
+    uint64_t m_currentTick;
+    int m_pendingCount;
+
+    std::vector<TimerNode> m_nodes;
+    std::vector<int> m_freeNodes;
+
+    /// @brief Première minuterie de chaque case, par niveau (-1 si vide).
+    std::array<int, TIMER_WHEEL_LEVEL_COUNT * TIMER_WHEEL_SLOT_COUNT> m_heads;
+};
+
+inline TimerHandle::TimerHandle() :
+    m_index(-1), m_generation(0)
+{
+}
+
+inline TimerHandle::TimerHandle(int index, uint32_t generation) :
+    m_index(index), m_generation(generation)
+{
+}
+
+inline bool TimerHandle::IsValid() const
+{
+    return m_index >= 0;
+}
+
+inline bool TimerWheel::IsPending(const TimerHandle &handle) const
+{
+    return GetNode(handle) != nullptr;
+}
+
+inline void TimerWheel::SetTickDuration(float tickDuration)
+{
+    assert(tickDuration > 0.f);
+    m_tickDuration = tickDuration;
+}
+
+inline float TimerWheel::GetTickDuration() const
+{
+    return m_tickDuration;
+}
+
+inline int TimerWheel::GetPendingCount() const
+{
+    return m_pendingCount;
+}
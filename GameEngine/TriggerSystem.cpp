@@ -0,0 +1,477 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "TriggerSystem.h"
+#include "GameBody.h"
+#include "b2_distance.h"
+
+#define TRIGGER_VERTEX_COUNT 4
+
+TriggerSystem::TriggerSystem() :
+    m_triggerIDs(), m_owners(), m_shapes(), m_localPoints1(), m_localPoints2(),
+    m_radii(), m_maskBits(), m_enabled(), m_worldVertices(), m_worldAABBs(),
+    m_indices(), m_freeIDs(), m_actors(), m_actorCategories(), m_actorAABBs(),
+    m_proxies(), m_activeTriggers(), m_activeActors(),
+    m_prevPairs(), m_pairs(), m_events()
+{
+}
+
+int TriggerSystem::AddAABB(
+    GameBody *owner, b2Vec2 center, b2Vec2 halfExtents, uint16 maskBits)
+{
+    return AddTrigger(owner, TriggerShape::AABB, center, halfExtents, 0.f, maskBits);
+}
+
+int TriggerSystem::AddCircle(
+    GameBody *owner, b2Vec2 center, float radius, uint16 maskBits)
+{
+    return AddTrigger(owner, TriggerShape::CIRCLE, center, center, radius, maskBits);
+}
+
+int TriggerSystem::AddCapsule(
+    GameBody *owner, b2Vec2 point1, b2Vec2 point2, float radius, uint16 maskBits)
+{
+    return AddTrigger(owner, TriggerShape::CAPSULE, point1, point2, radius, maskBits);
+}
+
+int TriggerSystem::AddTrigger(
+    GameBody *owner, TriggerShape shape,
+    b2Vec2 point1, b2Vec2 point2, float radius, uint16 maskBits)
+{
+    assert(owner);
+
+    int triggerID = -1;
+    if (m_freeIDs.empty())
+    {
+        triggerID = (int)m_indices.size();
+        m_indices.push_back(-1);
+    }
+    else
+    {
+        triggerID = m_freeIDs.back();
+        m_freeIDs.pop_back();
+    }
+    m_indices[triggerID] = (int)m_triggerIDs.size();
+
+    m_triggerIDs.push_back(triggerID);
+    m_owners.push_back(owner);
+    m_shapes.push_back(shape);
+    m_localPoints1.push_back(point1);
+    m_localPoints2.push_back(point2);
+    m_radii.push_back(radius);
+    m_maskBits.push_back(maskBits);
+    m_enabled.push_back(true);
+    m_worldAABBs.push_back(b2AABB());
+    for (int i = 0; i < TRIGGER_VERTEX_COUNT; i++)
+    {
+        m_worldVertices.push_back(b2Vec2_zero);
+    }
+
+    return triggerID;
+}
+
+void TriggerSystem::RemoveTrigger(int triggerID)
+{
+    assert(0 <= triggerID && triggerID < (int)m_indices.size());
+    const int index = m_indices[triggerID];
+    if (index < 0) return;
+
+    // Remplace le volume par le dernier du tableau
+    const int last = (int)m_triggerIDs.size() - 1;
+    if (index != last)
+    {
+        m_triggerIDs[index] = m_triggerIDs[last];
+        m_owners[index] = m_owners[last];
+        m_shapes[index] = m_shapes[last];
+        m_localPoints1[index] = m_localPoints1[last];
+        m_localPoints2[index] = m_localPoints2[last];
+        m_radii[index] = m_radii[last];
+        m_maskBits[index] = m_maskBits[last];
+        m_enabled[index] = m_enabled[last];
+        m_worldAABBs[index] = m_worldAABBs[last];
+        for (int i = 0; i < TRIGGER_VERTEX_COUNT; i++)
+        {
+            m_worldVertices[TRIGGER_VERTEX_COUNT * index + i] =
+                m_worldVertices[TRIGGER_VERTEX_COUNT * last + i];
+        }
+        m_indices[m_triggerIDs[index]] = index;
+    }
+
+    m_triggerIDs.pop_back();
+    m_owners.pop_back();
+    m_shapes.pop_back();
+    m_localPoints1.pop_back();
+    m_localPoints2.pop_back();
+    m_radii.pop_back();
+    m_maskBits.pop_back();
+    m_enabled.pop_back();
+    m_worldAABBs.pop_back();
+    m_worldVertices.resize(m_worldVertices.size() - TRIGGER_VERTEX_COUNT);
+
+    m_indices[triggerID] = -1;
+    m_freeIDs.push_back(triggerID);
+
+    RemovePairs(triggerID, nullptr);
+}
+
+void TriggerSystem::SetTriggerEnabled(int triggerID, bool enabled)
+{
+    assert(0 <= triggerID && triggerID < (int)m_indices.size());
+    const int index = m_indices[triggerID];
+    if (index < 0) return;
+
+    m_enabled[index] = enabled;
+}
+
+bool TriggerSystem::IsTriggerEnabled(int triggerID) const
+{
+    assert(0 <= triggerID && triggerID < (int)m_indices.size());
+    const int index = m_indices[triggerID];
+    if (index < 0) return false;
+
+    return m_enabled[index];
+}
+
+void TriggerSystem::AddActor(GameBody *actor, uint16 categoryBits)
+{
+    assert(actor);
+    auto it = std::find(m_actors.begin(), m_actors.end(), actor);
+    if (it != m_actors.end())
+    {
+        m_actorCategories[it - m_actors.begin()] = categoryBits;
+        return;
+    }
+
+    m_actors.push_back(actor);
+    m_actorCategories.push_back(categoryBits);
+    m_actorAABBs.push_back(b2AABB());
+}
+
+void TriggerSystem::RemoveActor(GameBody *actor)
+{
+    auto it = std::find(m_actors.begin(), m_actors.end(), actor);
+    if (it == m_actors.end()) return;
+
+    const int index = (int)(it - m_actors.begin());
+    const int last = (int)m_actors.size() - 1;
+    m_actors[index] = m_actors[last];
+    m_actorCategories[index] = m_actorCategories[last];
+    m_actorAABBs[index] = m_actorAABBs[last];
+    m_actors.pop_back();
+    m_actorCategories.pop_back();
+    m_actorAABBs.pop_back();
+
+    RemovePairs(-1, actor);
+}
+
+void TriggerSystem::RemoveGameBody(GameBody *gameBody)
+{
+    for (int i = (int)m_owners.size() - 1; i >= 0; i--)
+    {
+        if (m_owners[i] == gameBody)
+        {
+            RemoveTrigger(m_triggerIDs[i]);
+        }
+    }
+    RemoveActor(gameBody);
+}
+
+void TriggerSystem::RemovePairs(int triggerID, GameBody *actor)
+{
+    auto predicate = [triggerID, actor](const TriggerPair &pair)
+    {
+        return (pair.triggerID == triggerID) || (pair.actor == actor);
+    };
+    m_prevPairs.erase(
+        std::remove_if(m_prevPairs.begin(), m_prevPairs.end(), predicate),
+        m_prevPairs.end()
+    );
+    m_pairs.erase(
+        std::remove_if(m_pairs.begin(), m_pairs.end(), predicate),
+        m_pairs.end()
+    );
+}
+
+void TriggerSystem::UpdateWorldShapes()
+{
+    const int triggerCount = (int)m_triggerIDs.size();
+    for (int i = 0; i < triggerCount; i++)
+    {
+        b2Body *body = m_owners[i]->GetBody();
+        b2Transform xf;
+        if (body) xf = body->GetTransform();
+        else xf.SetIdentity();
+
+        b2Vec2 *vertices = &m_worldVertices[TRIGGER_VERTEX_COUNT * i];
+        b2Vec2 radius(m_radii[i], m_radii[i]);
+        b2AABB &aabb = m_worldAABBs[i];
+
+        switch (m_shapes[i])
+        {
+        case TriggerShape::AABB:
+        {
+            // Le volume suit la position du corps mais pas sa rotation
+            b2Vec2 center = xf.p + m_localPoints1[i];
+            b2Vec2 halfExtents = m_localPoints2[i];
+            vertices[0] = center + b2Vec2(-halfExtents.x, -halfExtents.y);
+            vertices[1] = center + b2Vec2(+halfExtents.x, -halfExtents.y);
+            vertices[2] = center + b2Vec2(+halfExtents.x, +halfExtents.y);
+            vertices[3] = center + b2Vec2(-halfExtents.x, +halfExtents.y);
+            aabb.lowerBound = vertices[0];
+            aabb.upperBound = vertices[2];
+            break;
+        }
+        case TriggerShape::CIRCLE:
+            vertices[0] = b2Mul(xf, m_localPoints1[i]);
+            aabb.lowerBound = vertices[0] - radius;
+            aabb.upperBound = vertices[0] + radius;
+            break;
+        case TriggerShape::CAPSULE:
+        default:
+            vertices[0] = b2Mul(xf, m_localPoints1[i]);
+            vertices[1] = b2Mul(xf, m_localPoints2[i]);
+            aabb.lowerBound = b2Min(vertices[0], vertices[1]) - radius;
+            aabb.upperBound = b2Max(vertices[0], vertices[1]) + radius;
+            break;
+        }
+    }
+
+    const int actorCount = (int)m_actors.size();
+    for (int i = 0; i < actorCount; i++)
+    {
+        b2Body *body = m_actors[i]->GetBody();
+        if (body == nullptr) continue;
+
+        const b2Transform &xf = body->GetTransform();
+        bool first = true;
+        b2AABB &aabb = m_actorAABBs[i];
+        aabb.lowerBound = xf.p;
+        aabb.upperBound = xf.p;
+        for (b2Fixture *fixture = body->GetFixtureList();
+             fixture != nullptr; fixture = fixture->GetNext())
+        {
+            if (fixture->IsSensor()) continue;
+
+            b2Shape *shape = fixture->GetShape();
+            for (int child = 0; child < shape->GetChildCount(); child++)
+            {
+                b2AABB childAABB;
+                shape->ComputeAABB(&childAABB, xf, child);
+                if (first) aabb = childAABB;
+                else aabb.Combine(childAABB);
+                first = false;
+            }
+        }
+    }
+}
+
+bool TriggerSystem::TestOverlap(int triggerIndex, int actorIndex) const
+{
+    const b2Vec2 *vertices = &m_worldVertices[TRIGGER_VERTEX_COUNT * triggerIndex];
+    b2DistanceInput input;
+    switch (m_shapes[triggerIndex])
+    {
+    case TriggerShape::AABB:
+        input.proxyA.Set(vertices, 4, 0.f);
+        break;
+    case TriggerShape::CIRCLE:
+        input.proxyA.Set(vertices, 1, m_radii[triggerIndex]);
+        break;
+    case TriggerShape::CAPSULE:
+    default:
+        input.proxyA.Set(vertices, 2, m_radii[triggerIndex]);
+        break;
+    }
+    input.transformA.SetIdentity();
+
+    b2Body *body = m_actors[actorIndex]->GetBody();
+    input.transformB = body->GetTransform();
+    input.useRadii = true;
+
+    for (b2Fixture *fixture = body->GetFixtureList();
+         fixture != nullptr; fixture = fixture->GetNext())
+    {
+        if (fixture->IsSensor()) continue;
+
+        b2Shape *shape = fixture->GetShape();
+        for (int child = 0; child < shape->GetChildCount(); child++)
+        {
+            input.proxyB.Set(shape, child);
+
+            b2SimplexCache cache;
+            cache.count = 0;
+            b2DistanceOutput output;
+            b2Distance(&output, &cache, &input);
+
+            if (output.distance < 10.0f * b2_epsilon)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TriggerSystem::AddPairIfOverlapping(int triggerIndex, int actorIndex)
+{
+    if ((m_maskBits[triggerIndex] & m_actorCategories[actorIndex]) == 0) return;
+    if (m_owners[triggerIndex] == m_actors[actorIndex]) return;
+    if (b2TestOverlap(m_worldAABBs[triggerIndex], m_actorAABBs[actorIndex]) == false) return;
+    if (TestOverlap(triggerIndex, actorIndex) == false) return;
+
+    m_pairs.push_back(TriggerPair{ m_triggerIDs[triggerIndex], m_actors[actorIndex] });
+}
+
+void TriggerSystem::Update()
+{
+    UpdateWorldShapes();
+
+    // Construit la liste des intervalles selon x
+    m_proxies.clear();
+    const int triggerCount = (int)m_triggerIDs.size();
+    for (int i = 0; i < triggerCount; i++)
+    {
+        GameBody *owner = m_owners[i];
+        if (m_enabled[i] == false || owner->IsEnabled() == false) continue;
+
+        m_proxies.push_back(SweepProxy{ m_worldAABBs[i].lowerBound.x, i, false });
+    }
+    const int actorCount = (int)m_actors.size();
+    for (int i = 0; i < actorCount; i++)
+    {
+        GameBody *actor = m_actors[i];
+        if (actor->IsEnabled() == false || actor->GetBody() == nullptr) continue;
+
+        m_proxies.push_back(SweepProxy{ m_actorAABBs[i].lowerBound.x, i, true });
+    }
+    std::sort(
+        m_proxies.begin(), m_proxies.end(),
+        [](const SweepProxy &proxyA, const SweepProxy &proxyB)
+        {
+            return proxyA.lowerX < proxyB.lowerX;
+        }
+    );
+
+    // Balayage : chaque intervalle est compar aux intervalles actifs de l'autre type
+    m_pairs.clear();
+    m_activeTriggers.clear();
+    m_activeActors.clear();
+    for (const SweepProxy &proxy : m_proxies)
+    {
+        const float lowerX = proxy.lowerX;
+        m_activeTriggers.erase(
+            std::remove_if(m_activeTriggers.begin(), m_activeTriggers.end(),
+                [this, lowerX](int i) { return m_worldAABBs[i].upperBound.x < lowerX; }),
+            m_activeTriggers.end()
+        );
+        m_activeActors.erase(
+            std::remove_if(m_activeActors.begin(), m_activeActors.end(),
+                [this, lowerX](int i) { return m_actorAABBs[i].upperBound.x < lowerX; }),
+            m_activeActors.end()
+        );
+
+        if (proxy.isActor)
+        {
+            for (int triggerIndex : m_activeTriggers)
+            {
+                AddPairIfOverlapping(triggerIndex, proxy.index);
+            }
+            m_activeActors.push_back(proxy.index);
+        }
+        else
+        {
+            for (int actorIndex : m_activeActors)
+            {
+                AddPairIfOverlapping(proxy.index, actorIndex);
+            }
+            m_activeTriggers.push_back(proxy.index);
+        }
+    }
+    std::sort(m_pairs.begin(), m_pairs.end());
+
+    // Compare les paires avec celles du pas prcdent
+    m_events.clear();
+    auto itPrev = m_prevPairs.begin();
+    auto itCurr = m_pairs.begin();
+    while (itPrev != m_prevPairs.end() || itCurr != m_pairs.end())
+    {
+        PendingEvent pending;
+        if (itPrev == m_prevPairs.end() ||
+            (itCurr != m_pairs.end() && *itCurr < *itPrev))
+        {
+            pending.type = EventType::ENTER;
+            pending.event.triggerID = itCurr->triggerID;
+            pending.event.actor = itCurr->actor;
+            ++itCurr;
+        }
+        else if (itCurr == m_pairs.end() || *itPrev < *itCurr)
+        {
+            pending.type = EventType::EXIT;
+            pending.event.triggerID = itPrev->triggerID;
+            pending.event.actor = itPrev->actor;
+            ++itPrev;
+        }
+        else
+        {
+            pending.type = EventType::STAY;
+            pending.event.triggerID = itCurr->triggerID;
+            pending.event.actor = itCurr->actor;
+            ++itPrev;
+            ++itCurr;
+        }
+        pending.event.owner = m_owners[m_indices[pending.event.triggerID]];
+        m_events.push_back(pending);
+    }
+    m_prevPairs.swap(m_pairs);
+
+    // Envoie les messages
+    // Messages : OnTriggerEnter(), OnTriggerStay(), OnTriggerExit()
+    for (PendingEvent &pending : m_events)
+    {
+        // Le volume a pu tre supprim par un message prcdent
+        if (m_indices[pending.event.triggerID] < 0) continue;
+
+        switch (pending.type)
+        {
+        case EventType::ENTER:
+            pending.event.owner->OnTriggerEnter(pending.event);
+            break;
+        case EventType::STAY:
+            pending.event.owner->OnTriggerStay(pending.event);
+            break;
+        case EventType::EXIT:
+        default:
+            pending.event.owner->OnTriggerExit(pending.event);
+            break;
+        }
+    }
+}
+
+void TriggerSystem::DrawGizmos(Gizmos &gizmos)
+{
+    const int triggerCount = (int)m_triggerIDs.size();
+    for (int i = 0; i < triggerCount; i++)
+    {
+        if (m_enabled[i] == false) continue;
+
+        const b2Vec2 *vertices = &m_worldVertices[TRIGGER_VERTEX_COUNT * i];
+        switch (m_shapes[i])
+        {
+        case TriggerShape::AABB:
+            gizmos.DrawAABB(m_worldAABBs[i]);
+            break;
+        case TriggerShape::CIRCLE:
+            gizmos.DrawCircle(vertices[0], m_radii[i]);
+            break;
+        case TriggerShape::CAPSULE:
+        default:
+            gizmos.DrawCircle(vertices[0], m_radii[i]);
+            gizmos.DrawCircle(vertices[1], m_radii[i]);
+            gizmos.DrawLine(vertices[0], vertices[1]);
+            break;
+        }
+    }
+}
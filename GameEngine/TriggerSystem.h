@@ -0,0 +1,191 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+#include "Gizmos.h"
+
+class GameBody;
+
+/// @brief Forme d'un volume de dclenchement.
+enum class TriggerShape : uint32_t
+{
+    AABB, CIRCLE, CAPSULE
+};
+
+/// @brief Evnement transmis au propritaire d'un volume de dclenchement.
+struct TriggerEvent
+{
+    /// @brief Identifiant du volume de dclenchement.
+    int triggerID;
+
+    /// @brief Objet propritaire du volume.
+    GameBody *owner;
+
+    /// @brief Acteur entr dans le volume.
+    GameBody *actor;
+};
+
+/// @brief Systme de volumes de dclenchement indpendant du gestionnaire
+/// de contacts de Box2D.
+/// Les volumes suivent le corps de leur propritaire et sont tests  chaque
+/// pas fixe contre une petite liste d'acteurs par un balayage tri selon x.
+/// Les volumes d'un propritaire sans corps sont fixes dans le monde.
+/// Les messages OnTriggerEnter(), OnTriggerStay() et OnTriggerExit()
+/// sont envoys au propritaire du volume.
+class TriggerSystem
+{
+public:
+    TriggerSystem();
+    TriggerSystem(TriggerSystem const&) = delete;
+    TriggerSystem& operator=(TriggerSystem const&) = delete;
+
+    /// @brief Ajoute un volume rectangulaire align sur les axes.
+    /// @param owner le propritaire du volume.
+    /// @param center le centre du volume dans le repre du corps du propritaire,
+    /// ou dans le repre du monde si le propritaire n'a pas de corps.
+    /// @param halfExtents les demi-dimensions du volume.
+    /// @param maskBits les catgories des acteurs dtects.
+    /// @return L'identifiant du volume.
+    int AddAABB(GameBody *owner, b2Vec2 center, b2Vec2 halfExtents, uint16 maskBits);
+
+    /// @brief Ajoute un volume circulaire.
+    /// @param owner le propritaire du volume.
+    /// @param center le centre du cercle dans le repre du corps du propritaire.
+    /// @param radius le rayon du cercle.
+    /// @param maskBits les catgories des acteurs dtects.
+    /// @return L'identifiant du volume.
+    int AddCircle(GameBody *owner, b2Vec2 center, float radius, uint16 maskBits);
+
+    /// @brief Ajoute un volume en forme de glule.
+    /// @param owner le propritaire du volume.
+    /// @param point1 premire extrmit du segment dans le repre du corps du propritaire.
+    /// @param point2 seconde extrmit du segment dans le repre du corps du propritaire.
+    /// @param radius le rayon de la glule.
+    /// @param maskBits les catgories des acteurs dtects.
+    /// @return L'identifiant du volume.
+    int AddCapsule(
+        GameBody *owner, b2Vec2 point1, b2Vec2 point2, float radius, uint16 maskBits
+    );
+
+    /// @brief Supprime un volume sans envoyer de message OnTriggerExit().
+    /// @param triggerID l'identifiant du volume.
+    void RemoveTrigger(int triggerID);
+
+    void SetTriggerEnabled(int triggerID, bool enabled);
+    bool IsTriggerEnabled(int triggerID) const;
+
+    /// @brief Ajoute un acteur dtect par les volumes.
+    /// Seules les fixtures solides de son corps sont testes.
+    /// @param actor l'acteur.
+    /// @param categoryBits les catgories de l'acteur.
+    void AddActor(GameBody *actor, uint16 categoryBits);
+    void RemoveActor(GameBody *actor);
+
+    /// @brief Supprime les volumes possds par un objet et l'acteur associ.
+    /// Cette mthode est appele  la destruction de chaque GameBody.
+    /// @param gameBody l'objet dtruit.
+    void RemoveGameBody(GameBody *gameBody);
+
+    /// @brief Teste les volumes contre les acteurs et envoie les messages.
+    /// Cette mthode est appele par la scne  chaque pas fixe.
+    void Update();
+
+    void DrawGizmos(Gizmos &gizmos);
+
+    int GetTriggerCount() const;
+    int GetActorCount() const;
+
+private:
+    struct TriggerPair
+    {
+        int triggerID;
+        GameBody *actor;
+
+        bool operator<(const TriggerPair &other) const;
+        bool operator==(const TriggerPair &other) const;
+    };
+
+    enum class EventType : uint32_t
+    {
+        ENTER, STAY, EXIT
+    };
+
+    struct PendingEvent
+    {
+        EventType type;
+        TriggerEvent event;
+    };
+
+    struct SweepProxy
+    {
+        float lowerX;
+        int index;
+        bool isActor;
+    };
+
+    int AddTrigger(
+        GameBody *owner, TriggerShape shape,
+        b2Vec2 point1, b2Vec2 point2, float radius, uint16 maskBits
+    );
+    void UpdateWorldShapes();
+    bool TestOverlap(int triggerIndex, int actorIndex) const;
+    void AddPairIfOverlapping(int triggerIndex, int actorIndex);
+    void RemovePairs(int triggerID, GameBody *actor);
+
+    // Volumes stocks en structure de tableaux, indics de manire dense
+    std::vector<int> m_triggerIDs;
+    std::vector<GameBody *> m_owners;
+    std::vector<TriggerShape> m_shapes;
+    std::vector<b2Vec2> m_localPoints1;
+    std::vector<b2Vec2> m_localPoints2;
+    std::vector<float> m_radii;
+    std::vector<uint16> m_maskBits;
+    std::vector<bool> m_enabled;
+
+    /// @brief Sommets des volumes dans le repre du monde (4 par volume).
+    std::vector<b2Vec2> m_worldVertices;
+    std::vector<b2AABB> m_worldAABBs;
+
+    /// @brief Indice dense de chaque identifiant (-1 si libre).
+    std::vector<int> m_indices;
+    std::vector<int> m_freeIDs;
+
+    std::vector<GameBody *> m_actors;
+    std::vector<uint16> m_actorCategories;
+    std::vector<b2AABB> m_actorAABBs;
+
+    std::vector<SweepProxy> m_proxies;
+    std::vector<int> m_activeTriggers;
+    std::vector<int> m_activeActors;
+
+    /// @brief Paires en contact au pas prcdent et au pas courant, tries.
+    std::vector<TriggerPair> m_prevPairs;
+    std::vector<TriggerPair> m_pairs;
+    std::vector<PendingEvent> m_events;
+};
+
+inline int TriggerSystem::GetTriggerCount() const
+{
+    return (int)m_triggerIDs.size();
+}
+
+inline int TriggerSystem::GetActorCount() const
+{
+    return (int)m_actors.size();
+}
+
+inline bool TriggerSystem::TriggerPair::operator<(const TriggerPair &other) const
+{
+    if (triggerID != other.triggerID) return triggerID < other.triggerID;
+    return std::less<GameBody *>()(actor, other.actor);
+}
+
+inline bool TriggerSystem::TriggerPair::operator==(const TriggerPair &other) const
+{
+    return (triggerID == other.triggerID) && (actor == other.actor);
+}
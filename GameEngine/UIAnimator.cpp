@@ -7,10 +7,11 @@
 #include "UIAnimator.h"
 
 UIAnimator::UIAnimator(Scene *scene) :
-    UIObject(scene), m_animator(),
+    UIObject(scene), m_animator(scene->GetAnimationSystem()),
     m_stretch(false), m_scale(1.f), m_anchor(Anchor::CENTER)
 {
     SetName("UIAnimator");
+    m_animator.SetClock(AnimClock::UNSCALED);
 }
 
 UIAnimator::~UIAnimator()
@@ -81,7 +82,16 @@ void UIAnimator::Update()
 {
     UIObject::Update();
     SetVisible(true);
+}
 
-    float dt = m_scene->GetTime().GetUnscaledDelta();
-    m_animator.Update(dt);
+uint64_t UIAnimator::GetRenderHash()
+{
+    // La source dsigne l'image courante de l'animation
+    uint64_t hash = UIObject::GetRenderHash();
+    hash = UIHashCombine(hash, (const void *)m_animator.GetTexture());
+    hash = UIHashCombine(hash, (const void *)m_animator.GetSourceRect());
+    hash = UIHashCombine(hash, (uint64_t)m_anchor);
+    hash = UIHashCombine(hash, m_scale);
+    hash = UIHashCombine(hash, (uint64_t)m_stretch);
+    return hash;
 }
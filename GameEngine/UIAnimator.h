@@ -24,6 +24,7 @@ public:
 
     virtual void Render() override;
     virtual void Update() override;
+    virtual uint64_t GetRenderHash() override;
 
 private:
     Animator m_animator;
@@ -7,7 +7,11 @@
 #include "UICanvas.h"
 
 UICanvas::UICanvas(Scene *scene) :
-    UIObject(scene)
+    UIObject(scene), m_cacheEnabled(true), m_cacheValid(false),
+    m_cacheLayer(DEFAULT_UI_LAYER), m_cacheRedrawCount(0),
+    m_cacheTexture(nullptr), m_cacheWidth(0), m_cacheHeight(0), m_cacheHash(0),
+    m_renderResetCount(Game_GetRenderResetCount()),
+    m_subtrees(), m_frameID(0), m_items(), m_cachedObjects(), m_directObjects()
 {
     SetName("UICanvas");
     m_rect.offsetMin.Set(0.f, 0.f);
@@ -19,12 +23,243 @@ UICanvas::UICanvas(Scene *scene) :
     SDL_RenderGetLogicalSize(g_renderer, &width, &height);
 
     m_pixelPerUnit = (float)width / 640.f;
+    m_rasterHeight = height;
+}
+
+UICanvas::~UICanvas()
+{
+    ReleaseCacheTexture();
 }
 
 void UICanvas::Update()
 {
     int width, height;
     SDL_RenderGetLogicalSize(g_renderer, &width, &height);
+    m_rasterHeight = height;
 
-    m_pixelPerUnit = (float)width / 640.f;
+    const float pixelPerUnit = (float)width / 640.f;
+    if (pixelPerUnit != m_pixelPerUnit)
+    {
+        m_pixelPerUnit = pixelPerUnit;
+        InvalidateLayout();
+    }
+}
+
+void UICanvas::RenderLayers(
+    std::vector<GameObject *>::iterator first,
+    std::vector<GameObject *>::iterator last)
+{
+    // Le contenu des textures cibles a t perdu
+    if (m_renderResetCount != Game_GetRenderResetCount())
+    {
+        m_renderResetCount = Game_GetRenderResetCount();
+        ReleaseCacheTexture();
+    }
+
+    if (m_cacheEnabled == false || UpdateCacheTexture() == false)
+    {
+        RenderDirect(first, last);
+        return;
+    }
+
+    m_frameID++;
+    m_items.clear();
+    m_cachedObjects.clear();
+    m_directObjects.clear();
+
+    // Empreinte de chaque sous-arbre, sensible  l'ordre des objets
+    for (auto it = first; it != last; ++it)
+    {
+        UIObject *uiObject = dynamic_cast<UIObject *>(*it);
+        if (uiObject == nullptr)
+        {
+            m_items.push_back(CanvasItem{ nullptr, nullptr, 0 });
+            continue;
+        }
+
+        SubtreeState &subtree = m_subtrees[GetSubtreeRoot(uiObject)];
+        if (subtree.frameID != m_frameID)
+        {
+            if (subtree.frameID != m_frameID - 1)
+            {
+                // Sous-arbre nouveau ou invisible  la frame prcdente
+                subtree.hash = 0;
+                subtree.changedLastFrame = false;
+            }
+            subtree.nextHash = UI_HASH_SEED;
+            subtree.frameID = m_frameID;
+        }
+        const uint64_t hash = uiObject->GetRenderHash();
+        subtree.nextHash = UIHashCombine(subtree.nextHash, (const void *)uiObject);
+        subtree.nextHash = UIHashCombine(subtree.nextHash, hash);
+
+        m_items.push_back(CanvasItem{ uiObject, &subtree, hash });
+    }
+
+    // Un sous-arbre modifi deux frames de suite est dessin directement,
+    // ce qui vite de redessiner le cache  chaque frame
+    for (auto it = m_subtrees.begin(); it != m_subtrees.end();)
+    {
+        SubtreeState &subtree = it->second;
+        if (subtree.frameID != m_frameID)
+        {
+            it = m_subtrees.erase(it);
+            continue;
+        }
+
+        const bool changed = (subtree.nextHash != subtree.hash);
+        subtree.isVolatile = changed && subtree.changedLastFrame;
+        subtree.changedLastFrame = changed;
+        subtree.hash = subtree.nextHash;
+        ++it;
+    }
+
+    // Les objets stables d'une couche suprieure  celle d'un sous-arbre
+    // dessin directement sont aussi dessins directement, pour respecter
+    // l'ordre des couches ; au sein d'une mme couche, les sous-arbres
+    // dessins directement passent par-dessus leurs voisins
+    int directLayer = INT_MAX;
+    for (const CanvasItem &item : m_items)
+    {
+        if (item.subtree && item.subtree->isVolatile)
+        {
+            directLayer = std::min(directLayer, item.object->GetLayer());
+        }
+    }
+
+    uint64_t hash = UI_HASH_SEED;
+    auto it = first;
+    for (const CanvasItem &item : m_items)
+    {
+        GameObject *object = *(it++);
+        if (item.subtree == nullptr || item.subtree->isVolatile ||
+            item.object->GetLayer() > directLayer)
+        {
+            m_directObjects.push_back(object);
+            continue;
+        }
+
+        m_cachedObjects.push_back(item.object);
+        hash = UIHashCombine(hash, (const void *)item.object);
+        hash = UIHashCombine(hash, item.hash);
+    }
+
+    if (m_cachedObjects.empty())
+    {
+        RenderDirect(first, last);
+        return;
+    }
+
+    if (m_cacheValid == false || hash != m_cacheHash)
+    {
+        PROFILE_SCOPE("UICanvas::RedrawCache");
+
+        // Les textures sont dessines en alpha prmultipli dans la cible
+        SDL_Texture *target = SDL_GetRenderTarget(g_renderer);
+        float scaleX = 1.f, scaleY = 1.f;
+        SDL_RenderGetScale(g_renderer, &scaleX, &scaleY);
+
+        SDL_SetRenderTarget(g_renderer, m_cacheTexture);
+        SDL_RenderSetScale(g_renderer, scaleX, scaleY);
+        SDL_SetRenderDrawColor(g_renderer, 0, 0, 0, 0);
+        SDL_RenderClear(g_renderer);
+
+        for (UIObject *uiObject : m_cachedObjects)
+        {
+            uiObject->Render();
+        }
+
+        SDL_SetRenderTarget(g_renderer, target);
+
+        m_cacheHash = hash;
+        m_cacheValid = true;
+        m_cacheRedrawCount++;
+    }
+
+    SDL_RenderCopy(g_renderer, m_cacheTexture, NULL, NULL);
+
+    for (GameObject *object : m_directObjects)
+    {
+        object->Render();
+    }
+}
+
+UIObject *UICanvas::GetSubtreeRoot(UIObject *uiObject)
+{
+    UIObject *parent = dynamic_cast<UIObject *>(uiObject->GetParent());
+    while (parent && parent != this)
+    {
+        uiObject = parent;
+        parent = dynamic_cast<UIObject *>(uiObject->GetParent());
+    }
+    return uiObject;
+}
+
+bool UICanvas::UpdateCacheTexture()
+{
+    // La texture a la rsolution de sortie pour ne pas flouter l'interface
+    int logicalW = 0, logicalH = 0;
+    float scaleX = 1.f, scaleY = 1.f;
+    SDL_RenderGetLogicalSize(g_renderer, &logicalW, &logicalH);
+    SDL_RenderGetScale(g_renderer, &scaleX, &scaleY);
+    if (logicalW <= 0 || logicalH <= 0)
+    {
+        SDL_GetRendererOutputSize(g_renderer, &logicalW, &logicalH);
+    }
+    const int width = (int)ceilf((float)logicalW * scaleX);
+    const int height = (int)ceilf((float)logicalH * scaleY);
+
+    if (m_cacheTexture && width == m_cacheWidth && height == m_cacheHeight)
+        return true;
+
+    ReleaseCacheTexture();
+
+    SDL_RendererInfo info = { 0 };
+    SDL_GetRendererInfo(g_renderer, &info);
+    if ((info.flags & SDL_RENDERER_TARGETTEXTURE) == 0 || width <= 0 || height <= 0)
+    {
+        m_cacheEnabled = false;
+        return false;
+    }
+
+    m_cacheTexture = SDL_CreateTexture(
+        g_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height
+    );
+    if (m_cacheTexture == nullptr)
+    {
+        std::cout << "WARNING - UICanvas cache texture: " << SDL_GetError() << std::endl;
+        m_cacheEnabled = false;
+        return false;
+    }
+
+    // Composition en alpha prmultipli
+    SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD
+    );
+    if (SDL_SetTextureBlendMode(m_cacheTexture, premultiplied) != 0)
+    {
+        SDL_SetTextureBlendMode(m_cacheTexture, SDL_BLENDMODE_BLEND);
+    }
+
+    m_cacheWidth = width;
+    m_cacheHeight = height;
+    return true;
+}
+
+void UICanvas::ReleaseCacheTexture()
+{
+    if (m_cacheTexture) SDL_DestroyTexture(m_cacheTexture);
+    m_cacheTexture = nullptr;
+    m_cacheValid = false;
+}
+
+void UICanvas::RenderDirect(
+    std::vector<GameObject *>::iterator first,
+    std::vector<GameObject *>::iterator last)
+{
+    for (auto it = first; it != last; ++it)
+    {
+        (*it)->Render();
+    }
 }
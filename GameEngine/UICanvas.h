@@ -13,16 +13,151 @@ class UICanvas : public UIObject
 {
 public:
     UICanvas(Scene *scene);
+    virtual ~UICanvas();
 
     float GetPixelsPerUnit() const;
 
+    /// @brief Renvoie la hauteur de la zone de rendu (en pixels logiques),
+    /// relue  chaque Update(). Elle reste valide pendant le dessin
+    /// dans la texture cache, o SDL ne renvoie plus la taille logique.
+    int GetRasterHeight() const;
+
     virtual void Update() override;
 
+    /// @brief Active le dessin de l'interface dans une texture cache.
+    /// Les UIObject des couches d'interface sont dessins dans la texture
+    /// uniquement lorsque l'empreinte de leur tat affich (rectangle, opacit,
+    /// couleur, contenu) change, puis la texture est copie en une fois.
+    /// L'empreinte est suivie par sous-arbre (enfant direct du canvas) :
+    /// un sous-arbre modifi deux frames de suite (chronomtre...) est dessin
+    /// directement par-dessus le cache, qui conserve les sous-arbres stables.
+    /// Si le moteur de rendu ne gre pas les textures cibles, l'interface
+    /// est dessine directement.
+    /// @param cacheEnabled boolen indiquant si le cache est utilis.
+    void SetCacheEnabled(bool cacheEnabled);
+    bool IsCacheEnabled() const;
+
+    /// @brief Dfinit la premire couche dessine dans le cache.
+    /// Les objets des couches suivantes qui ne sont pas des UIObject
+    /// sont dessins directement, par-dessus l'interface.
+    /// @param layer la premire couche d'interface.
+    void SetCacheLayer(int layer);
+    int GetCacheLayer() const;
+
+    /// @brief Force le prochain dessin du cache.
+    /// La perte des textures cibles est dtecte automatiquement
+    /// (Game_GetRenderResetCount()).
+    void InvalidateCache();
+
+    /// @brief Dessine les objets visibles des couches d'interface.
+    /// @param first le premier objet des couches d'interface.
+    /// @param last la fin des objets visibles.
+    void RenderLayers(
+        std::vector<GameObject *>::iterator first,
+        std::vector<GameObject *>::iterator last
+    );
+
+    /// @brief Renvoie le nombre de dessins du cache depuis la cration du canvas.
+    int GetCacheRedrawCount() const;
+
 protected:
     float m_pixelPerUnit;
+    int m_rasterHeight;
+
+private:
+    /// @brief Etat d'un sous-arbre de l'interface.
+    struct SubtreeState
+    {
+        /// @brief Empreinte du sous-arbre  la frame prcdente.
+        uint64_t hash;
+        uint64_t nextHash;
+
+        /// @brief Numro de la dernire frame o le sous-arbre tait visible.
+        uint32_t frameID;
+        bool changedLastFrame;
+
+        /// @brief Indique si le sous-arbre a chang deux frames de suite.
+        /// Il est alors dessin directement plutt que dans le cache.
+        bool isVolatile;
+    };
+
+    struct CanvasItem
+    {
+        UIObject *object;
+        SubtreeState *subtree;
+        uint64_t hash;
+    };
+
+    UIObject *GetSubtreeRoot(UIObject *uiObject);
+    bool UpdateCacheTexture();
+    void ReleaseCacheTexture();
+    void RenderDirect(
+        std::vector<GameObject *>::iterator first,
+        std::vector<GameObject *>::iterator last
+    );
+
+    bool m_cacheEnabled;
+    bool m_cacheValid;
+    int m_cacheLayer;
+    int m_cacheRedrawCount;
+
+    /// @brief Texture cible contenant l'interface, en alpha prmultipli.
+    SDL_Texture *m_cacheTexture;
+    int m_cacheWidth;
+    int m_cacheHeight;
+
+    /// @brief Empreinte de l'interface contenue dans le cache.
+    uint64_t m_cacheHash;
+
+    Uint64 m_renderResetCount;
+
+    /// @brief Etat de chaque sous-arbre, index par sa racine.
+    std::map<const UIObject *, SubtreeState> m_subtrees;
+    uint32_t m_frameID;
+
+    std::vector<CanvasItem> m_items;
+    std::vector<UIObject *> m_cachedObjects;
+    std::vector<GameObject *> m_directObjects;
 };
 
 inline float UICanvas::GetPixelsPerUnit() const
 {
     return m_pixelPerUnit;
-}
\ No newline at end of file
+}
+
+inline int UICanvas::GetRasterHeight() const
+{
+    return m_rasterHeight;
+}
+
+inline void UICanvas::SetCacheEnabled(bool cacheEnabled)
+{
+    m_cacheEnabled = cacheEnabled;
+    m_cacheValid = false;
+}
+
+inline bool UICanvas::IsCacheEnabled() const
+{
+    return m_cacheEnabled;
+}
+
+inline void UICanvas::SetCacheLayer(int layer)
+{
+    m_cacheLayer = layer;
+    m_cacheValid = false;
+}
+
+inline int UICanvas::GetCacheLayer() const
+{
+    return m_cacheLayer;
+}
+
+inline void UICanvas::InvalidateCache()
+{
+    m_cacheValid = false;
+}
+
+inline int UICanvas::GetCacheRedrawCount() const
+{
+    return m_cacheRedrawCount;
+}
@@ -0,0 +1,147 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "UIDigitText.h"
+#include "Scene.h"
+
+UIDigitText::UIDigitText(Scene *scene, GlyphStrip *glyphs, Color color) :
+    UIObject(scene), m_glyphs(glyphs), m_anchor(Anchor::CENTER),
+    m_charCount(0), m_chars{ 0 }, m_glyphIndices(), m_glyphX()
+{
+    AssertNew(m_glyphs);
+    SetName("UIDigitText");
+    SetColor(color);
+    m_glyphX.fill(0);
+}
+
+UIDigitText::~UIDigitText()
+{
+}
+
+void UIDigitText::SetString(const char *str)
+{
+    if (str == nullptr) str = "";
+
+    // Recherche du premier caractre modifi
+    int first = 0;
+    while (first < m_charCount && str[first] == m_chars[first])
+    {
+        first++;
+    }
+
+    int count = first;
+    while (count < UI_DIGIT_TEXT_CAPACITY && str[count] != '\0')
+    {
+        count++;
+    }
+    assert(str[count] == '\0' && "UIDigitText capacity exceeded");
+
+    if (first == count && count == m_charCount) return;
+
+    // Seuls les glyphes suivant le premier changement sont replacs
+    for (int i = first; i < count; i++)
+    {
+        const int index = m_glyphs->GetGlyphIndex(str[i]);
+        m_chars[i] = str[i];
+        m_glyphIndices[i] = (Sint8)index;
+        m_glyphX[i + 1] = m_glyphX[i] + m_glyphs->GetGlyphAdvance(index);
+    }
+    m_chars[count] = '\0';
+    m_charCount = count;
+}
+
+void UIDigitText::SetInteger(int value, const char *suffix)
+{
+    char buffer[UI_DIGIT_TEXT_CAPACITY + 1] = { 0 };
+    char digits[16] = { 0 };
+    int digitCount = 0;
+
+    // Chiffres crits  l'envers, sans passer par une chane alloue
+    unsigned int u = (value < 0) ? 0u - (unsigned int)value : (unsigned int)value;
+    do
+    {
+        digits[digitCount++] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u > 0);
+
+    int length = 0;
+    if (value < 0) buffer[length++] = '-';
+    while (digitCount > 0 && length < UI_DIGIT_TEXT_CAPACITY)
+    {
+        buffer[length++] = digits[--digitCount];
+    }
+    while (suffix && *suffix != '\0' && length < UI_DIGIT_TEXT_CAPACITY)
+    {
+        buffer[length++] = *suffix++;
+    }
+    buffer[length] = '\0';
+
+    SetString(buffer);
+}
+
+void UIDigitText::Render()
+{
+    if (IsUIEnabled() == false) return;
+    SDL_Texture *texture = m_glyphs->GetTexture();
+    if (texture == nullptr || m_charCount == 0) return;
+
+    // La bande est partage : la couleur est applique  chaque dessin
+    const Color color = GetColor();
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, (Uint8)(GetAlpha() * (float)color.a));
+
+    float anchorX = 0.f, anchorY = 0.f;
+    switch (m_anchor)
+    {
+    case Anchor::NORTH:      anchorX = 0.5f; anchorY = 0.0f; break;
+    case Anchor::NORTH_EAST: anchorX = 1.0f; anchorY = 0.0f; break;
+    case Anchor::WEST:       anchorX = 0.0f; anchorY = 0.5f; break;
+    case Anchor::CENTER:     anchorX = 0.5f; anchorY = 0.5f; break;
+    case Anchor::EAST:       anchorX = 1.0f; anchorY = 0.5f; break;
+    case Anchor::SOUTH_WEST: anchorX = 0.0f; anchorY = 1.0f; break;
+    case Anchor::SOUTH:      anchorX = 0.5f; anchorY = 1.0f; break;
+    case Anchor::SOUTH_EAST: anchorX = 1.0f; anchorY = 1.0f; break;
+    case Anchor::NORTH_WEST:
+    default:
+        break;
+    }
+
+    const SDL_FRect rect = GetRenderRect();
+    const float width = (float)m_glyphX[m_charCount];
+    const float height = (float)m_glyphs->GetHeight();
+    const float x = roundf(rect.x + anchorX * (rect.w - width));
+    const float y = roundf(rect.y + anchorY * (rect.h - height));
+
+    for (int i = 0; i < m_charCount; i++)
+    {
+        const int index = m_glyphIndices[i];
+        if (index < 0) continue;
+
+        const SDL_Rect &srcRect = m_glyphs->GetGlyphRect(index);
+        SDL_FRect dstRect = {
+            x + (float)m_glyphX[i], y, (float)srcRect.w, (float)srcRect.h
+        };
+        SDL_RenderCopyF(g_renderer, texture, &srcRect, &dstRect);
+    }
+}
+
+void UIDigitText::Update()
+{
+    UIObject::Update();
+    SetVisible(true);
+}
+
+uint64_t UIDigitText::GetRenderHash()
+{
+    uint64_t hash = UIObject::GetRenderHash();
+    for (int i = 0; i < m_charCount; i++)
+    {
+        hash = UIHashCombine(hash, (uint64_t)(unsigned char)m_chars[i]);
+    }
+    hash = UIHashCombine(hash, (const void *)m_glyphs->GetTexture());
+    hash = UIHashCombine(hash, (uint64_t)m_anchor);
+    return hash;
+}
@@ -0,0 +1,70 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+#include "UIObject.h"
+#include "GlyphStrip.h"
+
+/// @brief Nombre maximal de caractres d'un UIDigitText.
+#define UI_DIGIT_TEXT_CAPACITY 15
+
+/// @brief Texte court (compteurs, chronomtres) compos  partir des glyphes
+/// d'une GlyphStrip. La modification du texte n'alloue rien et seules
+/// les positions des glyphes  partir du premier caractre modifi
+/// sont recalcules. Les caractres absents de la bande sont ignors.
+class UIDigitText : public UIObject
+{
+public:
+    UIDigitText(Scene *scene, GlyphStrip *glyphs, Color color);
+    virtual ~UIDigitText();
+
+    void SetString(const char *str);
+
+    /// @brief Affiche un entier suivi d'un suffixe optionnel.
+    /// @param value la valeur affiche.
+    /// @param suffix le suffixe (par exemple "%") ou nullptr.
+    void SetInteger(int value, const char *suffix = nullptr);
+
+    void SetAnchor(Anchor anchor);
+    const char *GetString() const;
+
+    void GetNativePixelSize(int &pixelWidth, int &pixelHeight) const;
+
+    virtual void Render() override;
+    virtual void Update() override;
+    virtual uint64_t GetRenderHash() override;
+
+protected:
+    GlyphStrip *m_glyphs;
+    Anchor m_anchor;
+
+    int m_charCount;
+    char m_chars[UI_DIGIT_TEXT_CAPACITY + 1];
+    std::array<Sint8, UI_DIGIT_TEXT_CAPACITY> m_glyphIndices;
+
+    /// @protected
+    /// @brief Position horizontale de chaque glyphe en pixels.
+    /// m_glyphX[m_charCount] est la largeur du texte.
+    std::array<int, UI_DIGIT_TEXT_CAPACITY + 1> m_glyphX;
+};
+
+inline void UIDigitText::SetAnchor(Anchor anchor)
+{
+    m_anchor = anchor;
+}
+
+inline const char *UIDigitText::GetString() const
+{
+    return m_chars;
+}
+
+inline void UIDigitText::GetNativePixelSize(int &pixelWidth, int &pixelHeight) const
+{
+    pixelWidth = m_glyphX[m_charCount];
+    pixelHeight = m_glyphs->GetHeight();
+}
@@ -10,7 +10,7 @@
 
 UIGridLayout::UIGridLayout(Scene *scene, int rowCount, int columnCount) :
     UIObject(scene), m_rowCount(rowCount), m_colCount(columnCount),
-    m_gridMap(), m_padding(b2Vec2_zero),
+    m_items(), m_padding(b2Vec2_zero),
     m_rowSizes((size_t)rowCount, -1.f),
     m_colSizes((size_t)columnCount, -1.f),
     m_rowOffsets((size_t)rowCount + 1, 0.f),
@@ -18,6 +18,7 @@ UIGridLayout::UIGridLayout(Scene *scene, int rowCount, int columnCount) :
     m_rowSpacings((size_t)rowCount, 0.f),
     m_colSpacings((size_t)columnCount, 0.f),
     m_anchor(Anchor::NORTH_WEST),
+    m_layoutSize(b2Vec2_zero), m_hasStretch(true),
     m_debugGizmos(true)
 {
     SetName("UIGridLayout");
@@ -39,34 +40,41 @@ void UIGridLayout::AddObject(
 
     GridCell cell(rowIdx, columnIdx, rowSpan, columnSpan);
 
-    std::pair<int, int> indices = std::make_pair(rowIdx, columnIdx);
-    auto it = m_gridMap.find(object);
-    if (it != m_gridMap.end())
+    auto it = FindItem(object);
+    if (it != m_items.end())
     {
-        it->second = cell;
+        it->cell = cell;
     }
     else
     {
-        m_gridMap.insert(std::make_pair(object, cell));
+        m_items.push_back(GridItem(object, cell));
     }
     object->SetParent(this);
     object->SetUseParentAnimation(true);
     object->SetUseParentAlpha(true);
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::RemoveObject(UIObject *object)
 {
-    auto it = m_gridMap.find(object);
-    if (it == m_gridMap.end())
+    auto it = FindItem(object);
+    if (it == m_items.end())
     {
         return;
     }
 
     object->SetParent(m_scene->GetCanvas());
     object->SetUseParentAnimation(false);
+    InvalidateLayout();
 
-    m_gridMap.erase(it);
+    m_items.erase(it);
+}
+
+std::vector<UIGridLayout::GridItem>::iterator UIGridLayout::FindItem(UIObject *object)
+{
+    return std::find_if(m_items.begin(), m_items.end(),
+        [object](const GridItem &item) { return item.object == object; });
 }
 
 void UIGridLayout::SetRowSize(int index, float size)
@@ -77,7 +85,8 @@ void UIGridLayout::SetRowSize(int index, float size)
         return;
     }
     m_rowSizes[index] = size;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetRowSize(float size)
@@ -86,7 +95,8 @@ void UIGridLayout::SetRowSize(float size)
     {
         s = size;
     }
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetColumnSize(int index, float size)
@@ -97,7 +107,8 @@ void UIGridLayout::SetColumnSize(int index, float size)
         return;
     }
     m_colSizes[index] = size;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetColumnSize(float size)
@@ -106,7 +117,8 @@ void UIGridLayout::SetColumnSize(float size)
     {
         s = size;
     }
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetRowSpacing(int index, float spacing)
@@ -117,7 +129,8 @@ void UIGridLayout::SetRowSpacing(int index, float spacing)
         return;
     }
     m_rowSpacings[index] = spacing;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetRowSpacing(float spacing)
@@ -127,7 +140,8 @@ void UIGridLayout::SetRowSpacing(float spacing)
         s = spacing;
     }
     m_rowSpacings.back() = 0.f;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetColumnSpacing(int index, float spacing)
@@ -138,7 +152,8 @@ void UIGridLayout::SetColumnSpacing(int index, float spacing)
         return;
     }
     m_colSpacings[index] = spacing;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetColumnSpacing(float spacing)
@@ -148,7 +163,8 @@ void UIGridLayout::SetColumnSpacing(float spacing)
         s = spacing;
     }
     m_colSpacings.back() = 0.f;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::SetSpacing(float spacing)
@@ -163,30 +179,45 @@ void UIGridLayout::SetSpacing(float spacing)
     }
     m_rowSpacings.back() = 0.f;
     m_colSpacings.back() = 0.f;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 void UIGridLayout::Update()
 {
     UIObject::Update();
-    UpdateOffsets();
 
     if (m_debugGizmos) SetVisible(true);
 
+    UpdateLayout();
+}
+
+void UIGridLayout::UpdateLayout()
+{
+    // La taille de la grille n'intervient que pour les cellules relatives
+    const bool watchSize = m_hasStretch || m_layoutDirty;
+    b2Vec2 layoutSize = watchSize ? GetRectSize() : b2Vec2_zero;
+    if (m_layoutDirty == false && layoutSize == m_layoutSize) return;
+
+    m_layoutSize = layoutSize;
+    m_layoutDirty = false;
+    UpdateOffsets();
+    if (m_hasStretch == false) m_layoutSize = b2Vec2_zero;
+
     b2Vec2 gridDim(
         m_colOffsets[m_colCount],
         m_rowOffsets[m_rowCount]
     );
 
-    for (auto it = m_gridMap.begin(); it != m_gridMap.end(); ++it)
+    for (const GridItem &item : m_items)
     {
-        UIObject *object = it->first;
-        GridCell cell = it->second;
+        const GridCell &cell = item.cell;
+        UIRect rect = item.object->GetLocalRect();
 
-        object->GetLocalRect().offsetMin.x = +m_colOffsets[cell.colIdx];
-        object->GetLocalRect().offsetMax.x = +m_colOffsets[cell.colIdx + cell.colSpan] - m_colSpacings[cell.colIdx + cell.colSpan - 1];
-        object->GetLocalRect().offsetMin.y = -m_rowOffsets[cell.rowIdx + cell.rowSpan] + m_rowSpacings[cell.rowIdx + cell.rowSpan - 1];
-        object->GetLocalRect().offsetMax.y = -m_rowOffsets[cell.rowIdx];
+        rect.offsetMin.x = +m_colOffsets[cell.colIdx];
+        rect.offsetMax.x = +m_colOffsets[cell.colIdx + cell.colSpan] - m_colSpacings[cell.colIdx + cell.colSpan - 1];
+        rect.offsetMin.y = -m_rowOffsets[cell.rowIdx + cell.rowSpan] + m_rowSpacings[cell.rowIdx + cell.rowSpan - 1];
+        rect.offsetMax.y = -m_rowOffsets[cell.rowIdx];
 
         switch (m_anchor)
         {
@@ -194,26 +225,26 @@ void UIGridLayout::Update()
         case Anchor::NORTH_WEST:
         case Anchor::WEST:
         case Anchor::SOUTH_WEST:
-            object->GetLocalRect().anchorMin.x = 0.f;
-            object->GetLocalRect().anchorMax.x = 0.f;
-            object->GetLocalRect().offsetMin.x += m_padding.x;
-            object->GetLocalRect().offsetMax.x += m_padding.x;
+            rect.anchorMin.x = 0.f;
+            rect.anchorMax.x = 0.f;
+            rect.offsetMin.x += m_padding.x;
+            rect.offsetMax.x += m_padding.x;
             break;
         case Anchor::NORTH:
         case Anchor::CENTER:
         case Anchor::SOUTH:
-            object->GetLocalRect().anchorMin.x = 0.5f;
-            object->GetLocalRect().anchorMax.x = 0.5f;
-            object->GetLocalRect().offsetMin.x -= 0.5f * gridDim.x;
-            object->GetLocalRect().offsetMax.x -= 0.5f * gridDim.x;
+            rect.anchorMin.x = 0.5f;
+            rect.anchorMax.x = 0.5f;
+            rect.offsetMin.x -= 0.5f * gridDim.x;
+            rect.offsetMax.x -= 0.5f * gridDim.x;
             break;
         case Anchor::NORTH_EAST:
         case Anchor::EAST:
         case Anchor::SOUTH_EAST:
-            object->GetLocalRect().anchorMin.x = 1.f;
-            object->GetLocalRect().anchorMax.x = 1.f;
-            object->GetLocalRect().offsetMin.x -= gridDim.x + m_padding.x;
-            object->GetLocalRect().offsetMax.x -= gridDim.x + m_padding.x;
+            rect.anchorMin.x = 1.f;
+            rect.anchorMax.x = 1.f;
+            rect.offsetMin.x -= gridDim.x + m_padding.x;
+            rect.offsetMax.x -= gridDim.x + m_padding.x;
             break;
         }
 
@@ -223,28 +254,30 @@ void UIGridLayout::Update()
         case Anchor::NORTH_WEST:
         case Anchor::NORTH:
         case Anchor::NORTH_EAST:
-            object->GetLocalRect().anchorMin.y = 1.f;
-            object->GetLocalRect().anchorMax.y = 1.f;
-            object->GetLocalRect().offsetMin.y -= m_padding.y;
-            object->GetLocalRect().offsetMax.y -= m_padding.y;
+            rect.anchorMin.y = 1.f;
+            rect.anchorMax.y = 1.f;
+            rect.offsetMin.y -= m_padding.y;
+            rect.offsetMax.y -= m_padding.y;
             break;
         case Anchor::WEST:
         case Anchor::CENTER:
         case Anchor::EAST:
-            object->GetLocalRect().anchorMin.y = 0.5f;
-            object->GetLocalRect().anchorMax.y = 0.5f;
-            object->GetLocalRect().offsetMin.y += 0.5f * gridDim.y;
-            object->GetLocalRect().offsetMax.y += 0.5f * gridDim.y;
+            rect.anchorMin.y = 0.5f;
+            rect.anchorMax.y = 0.5f;
+            rect.offsetMin.y += 0.5f * gridDim.y;
+            rect.offsetMax.y += 0.5f * gridDim.y;
             break;
         case Anchor::SOUTH_WEST:
         case Anchor::SOUTH:
         case Anchor::SOUTH_EAST:
-            object->GetLocalRect().anchorMin.y = 0.f;
-            object->GetLocalRect().anchorMax.y = 0.f;
-            object->GetLocalRect().offsetMin.y += gridDim.y + m_padding.y;
-            object->GetLocalRect().offsetMax.y += gridDim.y + m_padding.y;
+            rect.anchorMin.y = 0.f;
+            rect.anchorMax.y = 0.f;
+            rect.offsetMin.y += gridDim.y + m_padding.y;
+            rect.offsetMax.y += gridDim.y + m_padding.y;
             break;
         }
+
+        item.object->SetLocalRect(rect);
     }
 }
 
@@ -316,7 +349,7 @@ void UIGridLayout::DrawGizmos(Gizmos &gizmos)
 
 void UIGridLayout::UpdateOffsets()
 {
-    b2Vec2 dimensions = GetRectSize();
+    b2Vec2 dimensions = m_layoutSize;
     b2Vec2 spacing = b2Vec2_zero;
     for (float x : m_colSpacings) spacing.x += x;
     for (float y : m_rowSpacings) spacing.y += y;
@@ -334,6 +367,7 @@ void UIGridLayout::UpdateOffsets()
         if (size > 0.f) fixedDim.y += size;
         else stretchSum.y += size;
     }
+    m_hasStretch = (stretchSum.x != 0.f) || (stretchSum.y != 0.f);
     b2Vec2 stretchSize = dimensions - fixedDim;
     stretchSize.x /= stretchSum.x;
     stretchSize.y /= stretchSum.y;
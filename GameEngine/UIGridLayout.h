@@ -9,6 +9,11 @@
 #include "Settings.h"
 #include "UIObject.h"
 
+/// @brief Grille plaant ses enfants dans des cellules.
+/// Les positions des lignes et des colonnes sont des sommes cumules,
+/// recalcules avec les rectangles des enfants uniquement lorsque les tailles,
+/// les espacements ou les lments changent (voir UIObject::SetLayoutDirty()),
+/// ou lorsque la taille de la grille change et qu'une cellule est relative.
 class UIGridLayout : public UIObject
 {
 public:
@@ -50,6 +55,15 @@ protected:
         int colSpan;
     };
 
+    struct GridItem
+    {
+        GridItem(UIObject *object, const GridCell &cell) :
+            object(object), cell(cell)
+        {}
+        UIObject *object;
+        GridCell cell;
+    };
+
     int m_rowCount;
     int m_colCount;
     b2Vec2 m_padding;
@@ -59,30 +73,41 @@ protected:
     std::vector<float> m_colSpacings;
     std::vector<float> m_rowOffsets;
     std::vector<float> m_colOffsets;
-    std::map <UIObject *, GridCell> m_gridMap;
+    std::vector<GridItem> m_items;
     Anchor m_anchor;
 
+    /// @protected
+    /// @brief Taille de la grille utilise par le dernier calcul.
+    /// Elle n'est surveille que si une ligne ou une colonne est relative.
+    b2Vec2 m_layoutSize;
+    bool m_hasStretch;
+
 private:
     void UpdateOffsets();
+    void UpdateLayout();
+    std::vector<GridItem>::iterator FindItem(UIObject *object);
     bool m_debugGizmos;
 };
 
 inline void UIGridLayout::SetPadding(float paddingX, float paddingY)
 {
     m_padding.Set(paddingX, paddingY);
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 inline void UIGridLayout::SetPadding(float padding)
 {
     m_padding.Set(padding, padding);
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 inline void UIGridLayout::SetAnchor(Anchor anchor)
 {
     m_anchor = anchor;
-    Update();
+    SetLayoutDirty();
+    UpdateLayout();
 }
 
 inline void UIGridLayout::SetDebugGizmos(bool debugGizmos)
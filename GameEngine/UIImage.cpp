@@ -94,6 +94,26 @@ void UIImage::Update()
     SetVisible(true);
 }
 
+uint64_t UIImage::GetRenderHash()
+{
+    uint64_t hash = UIObject::GetRenderHash();
+    hash = UIHashCombine(hash, (const void *)m_spriteGroup);
+    if (m_spriteGroup)
+    {
+        hash = UIHashCombine(hash, (const void *)m_spriteGroup->GetTexture());
+    }
+    hash = UIHashCombine(hash, (uint64_t)m_spriteID);
+    hash = UIHashCombine(hash, (uint64_t)m_renderMode);
+    hash = UIHashCombine(hash, (uint64_t)m_anchor);
+    hash = UIHashCombine(hash, m_scale);
+    hash = UIHashCombine(hash, (uint64_t)m_borders.left);
+    hash = UIHashCombine(hash, (uint64_t)m_borders.right);
+    hash = UIHashCombine(hash, (uint64_t)m_borders.top);
+    hash = UIHashCombine(hash, (uint64_t)m_borders.bottom);
+    hash = UIHashCombine(hash, m_borders.scale);
+    return hash;
+}
+
 void UIImage::GetNativePixelSize(int &pixelWidth, int &pixelHeight) const
 {
     const SDL_Rect *src = m_spriteGroup->GetSourceRect(m_spriteID);
@@ -41,6 +41,7 @@ public:
 
     virtual void Render() override;
     virtual void Update() override;
+    virtual uint64_t GetRenderHash() override;
 
 private:
     SpriteGroup *m_spriteGroup;
@@ -11,6 +11,7 @@
 UIInput::UIInput() :
     up(false), down(false), left(false), right(false), start(false),
     validatePressed(false), validateReleased(false), cancel(false),
+    pointerMoved(false), pointerPressed(false), pointerReleased(false), pointerPos{ 0.f, 0.f },
     m_leftAxisX(0), m_leftAxisY(0),
     m_deadZone(8000), m_activeZone(1 << 14)
 {
@@ -22,6 +22,14 @@ public:
     bool validateReleased;
     bool cancel;
 
+    /// @brief Pointeur (souris) dans le repère du canvas.
+    /// Un élément survolé est sélectionné et un clic sur l'élément
+    /// sélectionné équivaut à la validation.
+    bool pointerMoved;
+    bool pointerPressed;
+    bool pointerReleased;
+    SDL_FPoint pointerPos;
+
     void SetAxisLeftX(Sint16 value);
     void SetAxisLeftY(Sint16 value);
 
@@ -348,7 +348,6 @@ void UIItemList::AddItemObject(int itemIdx, UIObject *object, Item &item)
         UIFadeDef fadeDef;
         fadeDef.duration = 0.25f;
         fadeDef.fadeOpacity = true;
-        fadeDef.easing = EasingFct_Cos;
         object->SetFadeInAnimation(fadeDef);
         object->SetFadeOutAnimation(fadeDef);
     }
@@ -383,7 +382,7 @@ void UIItemList::AddArrow(UIObject *object, b2Vec2 shift)
     object->SetUIEnabled(false);
     object->SetTransformDuration(0.1f);
 
-    LerpAnim<b2Vec2> *shiftAnim = nullptr;
+    UIShiftAnim *shiftAnim = nullptr;
 
     shiftAnim = object->CreateShiftAnimation("Move", b2Vec2_zero, shift);
     shiftAnim->SetCycleCount(1);
@@ -393,7 +392,6 @@ void UIItemList::AddArrow(UIObject *object, b2Vec2 shift)
     UIFadeDef fadeDef;
     fadeDef.duration = 0.25f;
     fadeDef.fadeOpacity = true;
-    fadeDef.easing = EasingFct_InOut;
     object->SetFadeInAnimation(fadeDef);
     object->SetFadeOutAnimation(fadeDef);
 }
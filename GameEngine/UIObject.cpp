@@ -26,12 +26,14 @@ UIRect::UIRect(b2Vec2 anchorMin, b2Vec2 anchorMax, b2Vec2 offsetMin, b2Vec2 offs
 {
 };
 
+Uint64 UIObject::s_layoutVersion = 0;
 
 UIObject::UIObject(Scene *scene) :
-    GameObject(scene, DEFAULT_UI_LAYER), m_rect(),
+    GameObject(scene, DEFAULT_UI_LAYER), m_rect(), m_layoutDirty(true),
     m_useParentAnim(true), m_useParentAlpha(true), m_alpha(1.f), m_fadeChildren(true),
     m_alphaAnimMap(), m_shiftAnimMap(), m_animListeners(),
-    m_targets(), m_targetMask(0), m_transformAnim("Transform_Anim"), m_uiEnabled(true),
+    m_targets(), m_targetMask(0), m_uiEnabled(true),
+    m_transformAnim(scene->GetAnimationSystem(), "Transform_Anim"),
     m_fadeIAnim(nullptr), m_fadeOAnim(nullptr)
 {
     SetName("UIObject");
@@ -41,6 +43,7 @@ UIObject::UIObject(Scene *scene) :
     m_transformAnim.SetCycleCount(1);
     m_transformAnim.SetCycleTime(0.25f);
     m_transformAnim.SetEasing(EasingFct_InOut);
+    m_transformAnim.SetClock(AnimClock::UNSCALED);
 
     AddAnimListener(this);
 }
@@ -75,16 +78,16 @@ void UIObject::SetTargetColor(Color color)
     m_targets[1].color = color;
 }
 
-void UIObject::UpdateTransformToTarget(float dt)
+void UIObject::UpdateTransformToTarget()
 {
     if (m_transformAnim.IsPlaying() == false) return;
 
-    m_transformAnim.Update(dt);
     float t = m_transformAnim.GetProgression();
 
     if ((m_targetMask & TARGET_RECT) != 0)
     {
         m_rect = Math::Lerp(m_targets[0].rect, m_targets[1].rect, t);
+        s_layoutVersion++;
     }
     if ((m_targetMask & TARGET_ALPHA) != 0)
     {
@@ -185,7 +188,7 @@ float UIObject::GetInheritedAnimAlpha() const
         auto &alphaMap = uiObject->m_alphaAnimMap;
         for (auto it = alphaMap.begin(); it != alphaMap.end(); ++it)
         {
-            LerpAnim<float> *alphaAnim = it->second;
+            UIAlphaAnim *alphaAnim = it->second;
             if (alphaAnim->IsStopped()) continue;
 
             alpha *= alphaAnim->GetValue();
@@ -201,10 +204,12 @@ float UIObject::GetInheritedAnimAlpha() const
 
 SDL_FRect UIObject::GetCanvasRect() const
 {
-    int rasterW, rasterH;
-    SDL_RenderGetLogicalSize(g_renderer, &rasterW, &rasterH);
+    // Taille lue par le canvas : pendant le dessin dans une texture cible,
+    // SDL ne renvoie plus la taille logique de la fentre
+    UICanvas *canvas = m_scene->GetCanvas();
+    const float pixelsPerUnit = canvas->GetPixelsPerUnit();
+    const int rasterH = canvas->GetRasterHeight();
 
-    float pixelsPerUnit = m_scene->GetCanvas()->GetPixelsPerUnit();
     SDL_FRect rect = GetCanvasRectRec(pixelsPerUnit);
     rect.y = rasterH - rect.y - rect.h;
     return rect;
@@ -223,24 +228,14 @@ void UIObject::Update()
 
     if (IsUIEnabled() == false) return;
 
-    float dt = m_scene->GetTime().GetUnscaledDelta();
-
-    for (auto it = m_alphaAnimMap.begin(); it != m_alphaAnimMap.end(); ++it)
-    {
-        it->second->Update(dt);
-    }
-    for (auto it = m_shiftAnimMap.begin(); it != m_shiftAnimMap.end(); ++it)
-    {
-        it->second->Update(dt);
-    }
-
-    UpdateTransformToTarget(dt);
+    // Les animations sont avances par l'AnimationSystem de la scne
+    UpdateTransformToTarget();
 }
 
-LerpAnim<float> *UIObject::CreateAlphaAnimation(
+UIAlphaAnim *UIObject::CreateAlphaAnimation(
     const std::string &name, float alpha0, float alpha1)
 {
-    LerpAnim<float> *anim = nullptr;
+    UIAlphaAnim *anim = nullptr;
     auto itAlpha = m_alphaAnimMap.find(name);
     if (itAlpha != m_alphaAnimMap.end())
     {
@@ -251,7 +246,8 @@ LerpAnim<float> *UIObject::CreateAlphaAnimation(
     }
 
     // Cration de l'animation
-    anim = new LerpAnim<float>(name, alpha0, alpha1);
+    anim = new UIAlphaAnim(m_scene->GetAnimationSystem(), name, alpha0, alpha1);
+    anim->SetClock(AnimClock::UNSCALED);
     m_alphaAnimMap.insert(std::make_pair(name, anim));
     for (UIAnimListener *listener : m_animListeners)
     {
@@ -260,10 +256,10 @@ LerpAnim<float> *UIObject::CreateAlphaAnimation(
     return anim;
 }
 
-LerpAnim<b2Vec2> *UIObject::CreateShiftAnimation(
+UIShiftAnim *UIObject::CreateShiftAnimation(
     const std::string &name, b2Vec2 shift0, b2Vec2 shift1)
 {
-    LerpAnim<b2Vec2> *anim = nullptr;
+    UIShiftAnim *anim = nullptr;
     auto itShift = m_shiftAnimMap.find(name);
     if (itShift != m_shiftAnimMap.end())
     {
@@ -274,7 +270,8 @@ LerpAnim<b2Vec2> *UIObject::CreateShiftAnimation(
     }
 
     // Cration de l'animation
-    anim = new LerpAnim<b2Vec2>(name, shift0, shift1);
+    anim = new UIShiftAnim(m_scene->GetAnimationSystem(), name, shift0, shift1);
+    anim->SetClock(AnimClock::UNSCALED);
     m_shiftAnimMap.insert(std::make_pair(name, anim));
     for (UIAnimListener *listener : m_animListeners)
     {
@@ -285,19 +282,17 @@ LerpAnim<b2Vec2> *UIObject::CreateShiftAnimation(
 
 void UIObject::SetFadeInAnimation(UIFadeDef fadeDef)
 {
-    LerpAnim<float> *alphaAnim = CreateAlphaAnimation(
+    UIAlphaAnim *alphaAnim = CreateAlphaAnimation(
         "FadeIn_Alpha", fadeDef.fadeOpacity ? 0.f : 1.f, 1.f
     );
-    alphaAnim->SetEasing(fadeDef.easing);
     alphaAnim->SetDelay(fadeDef.delay);
     alphaAnim->SetCycleTime(fadeDef.duration);
     alphaAnim->SetCycleCount(1);
     alphaAnim->SubFlags(AnimFlag::STOP_AT_END);
 
-    LerpAnim<b2Vec2> *shiftAnim = CreateShiftAnimation(
+    UIShiftAnim *shiftAnim = CreateShiftAnimation(
         "FadeIn_Shift", fadeDef.shift, b2Vec2_zero
     );
-    shiftAnim->SetEasing(fadeDef.easing);
     shiftAnim->SetDelay(fadeDef.delay);
     shiftAnim->SetCycleTime(fadeDef.duration);
     shiftAnim->SetCycleCount(1);
@@ -308,19 +303,17 @@ void UIObject::SetFadeInAnimation(UIFadeDef fadeDef)
 
 void UIObject::SetFadeOutAnimation(UIFadeDef fadeDef)
 {
-    LerpAnim<float> *alphaAnim = CreateAlphaAnimation(
+    UIAlphaAnim *alphaAnim = CreateAlphaAnimation(
         "FadeOut_Alpha", 1.f, fadeDef.fadeOpacity ? 0.f : 1.f
     );
-    alphaAnim->SetEasing(fadeDef.easing);
     alphaAnim->SetDelay(fadeDef.delay);
     alphaAnim->SetCycleTime(fadeDef.duration);
     alphaAnim->SetCycleCount(1);
     alphaAnim->SubFlags(AnimFlag::STOP_AT_END);
 
-    LerpAnim<b2Vec2> *shiftAnim = CreateShiftAnimation(
+    UIShiftAnim *shiftAnim = CreateShiftAnimation(
         "FadeOut_Shift", b2Vec2_zero, fadeDef.shift
     );
-    shiftAnim->SetEasing(fadeDef.easing);
     shiftAnim->SetDelay(fadeDef.delay);
     shiftAnim->SetCycleTime(fadeDef.duration);
     shiftAnim->SetCycleCount(1);
@@ -431,6 +424,24 @@ SDL_FRect UIObject::GetRenderRect() const
     return rect;
 }
 
+uint64_t UIObject::GetRenderHash()
+{
+    const SDL_FRect rect = GetRenderRect();
+    const Color color = GetColor();
+    const uint32_t rgba = ((uint32_t)color.r << 24) | ((uint32_t)color.g << 16)
+        | ((uint32_t)color.b << 8) | (uint32_t)color.a;
+
+    uint64_t hash = UI_HASH_SEED;
+    hash = UIHashCombine(hash, rect.x);
+    hash = UIHashCombine(hash, rect.y);
+    hash = UIHashCombine(hash, rect.w);
+    hash = UIHashCombine(hash, rect.h);
+    hash = UIHashCombine(hash, GetAlpha());
+    hash = UIHashCombine(hash, (uint64_t)rgba);
+    hash = UIHashCombine(hash, (uint64_t)IsUIEnabled());
+    return hash;
+}
+
 float UIObject::GetAlpha() const
 {
     return GetInheritedBaseAlpha() * GetInheritedAnimAlpha();
@@ -441,7 +452,7 @@ b2Vec2 UIObject::GetShift() const
     b2Vec2 shift = b2Vec2_zero;
     for (auto it = m_shiftAnimMap.begin(); it != m_shiftAnimMap.end(); ++it)
     {
-        LerpAnim<b2Vec2> *shiftAnim = it->second;
+        UIShiftAnim *shiftAnim = it->second;
         if (shiftAnim->IsStopped()) continue;
 
         shift += shiftAnim->GetValue();
@@ -537,7 +548,7 @@ int UIObject::PlayAlphaAnim(const std::string &name)
 {
     try
     {
-        LerpAnim<float> *anim = m_alphaAnimMap.at(name);
+        UIAlphaAnim *anim = m_alphaAnimMap.at(name);
         anim->Play();
     }
     catch (const std::out_of_range &e)
@@ -553,7 +564,7 @@ int UIObject::PlayShiftAnim(const std::string &name)
 {
     try
     {
-        LerpAnim<b2Vec2> *anim = m_shiftAnimMap.at(name);
+        UIShiftAnim *anim = m_shiftAnimMap.at(name);
         anim->Play();
     }
     catch (const std::out_of_range &e)
@@ -584,6 +595,7 @@ void UIObject::TransformToTarget()
     if ((m_targetMask & TARGET_RECT) != 0)
     {
         m_rect = m_targets[1].rect;
+        s_layoutVersion++;
     }
     if ((m_targetMask & TARGET_ALPHA) != 0)
     {
@@ -611,14 +623,14 @@ bool UIObject::IsUIEnabled() const
     return parent->IsUIEnabled();
 }
 
-LerpAnim<float> *UIObject::GetAlphaAnim(const std::string &name)
+UIAlphaAnim *UIObject::GetAlphaAnim(const std::string &name)
 {
     auto it = m_alphaAnimMap.find(name);
     if (it != m_alphaAnimMap.end()) return it->second;
     return nullptr;
 }
 
-LerpAnim<b2Vec2> *UIObject::GetShiftAnim(const std::string &name)
+UIShiftAnim *UIObject::GetShiftAnim(const std::string &name)
 {
     auto it = m_shiftAnimMap.find(name);
     if (it != m_shiftAnimMap.end()) return it->second;
@@ -646,6 +658,5 @@ void UIFadeDef::Reset(float durationIn)
     shift = b2Vec2_zero;
     delay = 0.f;
     duration = durationIn;
-    easing = EasingFct_InOut;
     fadeOpacity = true;
 }
@@ -46,19 +46,43 @@ class UIFadeDef
 {
 public:
     UIFadeDef() :
-        shift(b2Vec2_zero), delay(0.f), duration(0.25f),
-        easing(EasingFct_InOut), fadeOpacity(true)
+        shift(b2Vec2_zero), delay(0.f), duration(0.25f), fadeOpacity(true)
     {}
 
     b2Vec2 shift;
     float delay;
     float duration;
-    EasingFct easing;
     bool fadeOpacity;
 
     void Reset(float duration);
 };
 
+/// @brief Graine des empreintes de l'tat affich des UIObject.
+#define UI_HASH_SEED 0xCBF29CE484222325ULL
+
+/// @brief Ajoute une valeur  une empreinte (FNV-1a sur 64 bits).
+inline uint64_t UIHashCombine(uint64_t hash, uint64_t value)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        hash ^= (value >> (8 * i)) & 0xFF;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+inline uint64_t UIHashCombine(uint64_t hash, float value)
+{
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    return UIHashCombine(hash, (uint64_t)bits);
+}
+
+inline uint64_t UIHashCombine(uint64_t hash, const void *pointer)
+{
+    return UIHashCombine(hash, (uint64_t)(uintptr_t)pointer);
+}
+
 class UIAnimListener : public AnimationListener
 {
 public:
@@ -70,10 +94,16 @@ public:
     virtual void OnTransformEnd(UIObject *which) {};
 };
 
+/// @brief Animations d'opacit et de dcalage de l'interface.
+/// Leur courbe d'acclration est fixe  la compilation et dveloppe en ligne ;
+/// SetEasing() est donc sans effet sur elles.
+typedef LerpAnim<float, EaseInOut> UIAlphaAnim;
+typedef LerpAnim<b2Vec2, EaseInOut> UIShiftAnim;
+
 struct UIFadeAnim
 {
-    LerpAnim<float> *alphaAnim;
-    LerpAnim<b2Vec2> *shiftAnim;
+    UIAlphaAnim *alphaAnim;
+    UIShiftAnim *shiftAnim;
 };
 
 class UIObject : public GameObject, public UIAnimListener
@@ -83,6 +113,9 @@ public:
     virtual ~UIObject();
 
     void SetLocalRect(const UIRect &rect);
+
+    /// @brief Renvoie le rectangle local de l'objet.
+    /// Le rectangle tant modifiable, la disposition est considre comme modifie.
     UIRect &GetLocalRect();
     SDL_FRect GetCanvasRect() const;
     bool Contains(const SDL_FPoint &point) const;
@@ -127,14 +160,14 @@ public:
     bool UsingParentAnimation() const;
     bool UsingParentAlpha() const;
 
-    LerpAnim<float> *CreateAlphaAnimation(const std::string &name, float alpha0, float alpha1);
-    LerpAnim<b2Vec2> *CreateShiftAnimation(const std::string &name, b2Vec2 shift0, b2Vec2 shift1);
+    UIAlphaAnim *CreateAlphaAnimation(const std::string &name, float alpha0, float alpha1);
+    UIShiftAnim *CreateShiftAnimation(const std::string &name, b2Vec2 shift0, b2Vec2 shift1);
 
     int PlayAlphaAnim(const std::string &name);
     int PlayShiftAnim(const std::string &name);
 
-    LerpAnim<float> *GetAlphaAnim(const std::string &name);
-    LerpAnim<b2Vec2> *GetShiftAnim(const std::string &name);
+    UIAlphaAnim *GetAlphaAnim(const std::string &name);
+    UIShiftAnim *GetShiftAnim(const std::string &name);
 
     void SetOpacity(float alpha);
 
@@ -144,8 +177,30 @@ public:
 
     b2Vec2 GetRectSize() const;
 
+    /// @brief Renvoie une empreinte de l'tat affich par Render().
+    /// Le canvas ne redessine l'interface que si une empreinte change.
+    /// Les classes filles qui dessinent un contenu propre (texte, image...)
+    /// doivent l'ajouter  l'empreinte de UIObject.
+    virtual uint64_t GetRenderHash();
+
     virtual void OnAnimationEnd(Animation *which, const std::string &name) override;
 
+    /// @brief Renvoie un compteur incrment  chaque modification de la
+    /// disposition de l'interface (rectangle local, transformation vers une cible,
+    /// chelle du canvas). Les index de rectangles sont reconstruits
+    /// uniquement lorsqu'il change.
+    static Uint64 GetLayoutVersion();
+
+    /// @brief Signale une modification de la disposition qui n'est pas
+    /// dtecte automatiquement, par exemple un changement de parent.
+    static void InvalidateLayout();
+
+    /// @brief Demande le recalcul de la disposition des enfants de l'objet.
+    /// Les conteneurs (UIGridLayout...) ne repositionnent leurs enfants
+    /// que lorsque leur disposition est marque comme modifie.
+    void SetLayoutDirty();
+    bool IsLayoutDirty() const;
+
 protected:
     virtual void PlayFadeInAlone();
     virtual void PlayFadeOutAlone();
@@ -155,14 +210,18 @@ protected:
 
     UIRect m_rect;
 
+    /// @protected
+    /// @brief Indique que la disposition des enfants doit tre recalcule.
+    bool m_layoutDirty;
+
 private:
-    void UpdateTransformToTarget(float dt);
+    void UpdateTransformToTarget();
     SDL_FRect GetCanvasRectRec(float pixelsPerUnit) const;
     float GetInheritedBaseAlpha() const;
     float GetInheritedAnimAlpha() const;
 
-    std::map<std::string, LerpAnim<float>*> m_alphaAnimMap;
-    std::map<std::string, LerpAnim<b2Vec2>*> m_shiftAnimMap;
+    std::map<std::string, UIAlphaAnim*> m_alphaAnimMap;
+    std::map<std::string, UIShiftAnim*> m_shiftAnimMap;
     std::set<UIAnimListener *> m_animListeners;
 
     bool m_useParentAnim;
@@ -184,21 +243,45 @@ private:
     };
     int m_targetMask;
     std::array<UITarget, 2> m_targets;
-    LerpAnim<b2Vec2> *m_fadeIAnim;
-    LerpAnim<b2Vec2> *m_fadeOAnim;
+    UIShiftAnim *m_fadeIAnim;
+    UIShiftAnim *m_fadeOAnim;
     Animation m_transformAnim;
+
+    static Uint64 s_layoutVersion;
 };
 
 inline void UIObject::SetLocalRect(const UIRect &rect)
 {
     m_rect = rect;
+    s_layoutVersion++;
 }
 
 inline UIRect &UIObject::GetLocalRect()
 {
+    s_layoutVersion++;
     return m_rect;
 }
 
+inline Uint64 UIObject::GetLayoutVersion()
+{
+    return s_layoutVersion;
+}
+
+inline void UIObject::InvalidateLayout()
+{
+    s_layoutVersion++;
+}
+
+inline void UIObject::SetLayoutDirty()
+{
+    m_layoutDirty = true;
+}
+
+inline bool UIObject::IsLayoutDirty() const
+{
+    return m_layoutDirty;
+}
+
 inline void UIObject::SetTransformEasing(EasingFct easing)
 {
     m_transformAnim.SetEasing(easing);
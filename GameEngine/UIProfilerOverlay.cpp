@@ -0,0 +1,150 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "UIProfilerOverlay.h"
+#include "Scene.h"
+#include "Profiler.h"
+
+#define OVERLAY_MARGIN 10.f
+
+UIProfilerOverlay::UIProfilerOverlay(Scene *scene, TTF_Font *font) :
+    UIObject(scene), m_font(font), m_lines(), m_lineCount(0),
+    m_refreshPeriod(0.25f), m_refreshAccu(0.f)
+{
+    SetName("UIProfilerOverlay");
+    SetLayer(DEFAULT_UI_LAYER + 16);
+
+    AssertNew(font);
+    RefreshLines();
+}
+
+UIProfilerOverlay::~UIProfilerOverlay()
+{
+    for (Text *line : m_lines)
+    {
+        delete line;
+    }
+}
+
+void UIProfilerOverlay::Update()
+{
+    UIObject::Update();
+    SetVisible(true);
+
+    // Limite la cration de textures en ne rafrachissant que priodiquement
+    m_refreshAccu += m_scene->GetTime().GetUnscaledDelta();
+    if (m_refreshAccu < m_refreshPeriod) return;
+
+    m_refreshAccu = 0.f;
+    RefreshLines();
+}
+
+void UIProfilerOverlay::RefreshLines()
+{
+    char buffer[128] = { 0 };
+    const SceneStats &stats = m_scene->GetStats();
+    const float frameMS = Profiler::GetFrameMS();
+
+    m_lineCount = 0;
+
+    snprintf(
+        buffer, sizeof(buffer), "Frame : %.2f ms (%.0f FPS)",
+        frameMS, (frameMS > 0.f) ? 1000.f / frameMS : 0.f
+    );
+    SetLine(m_lineCount++, buffer);
+
+    snprintf(
+        buffer, sizeof(buffer), "Pas fixes : %d (%.2f ms/pas, %d perdus%s)",
+        stats.fixedStepCount, stats.fixedStepCostMS, stats.droppedStepCount,
+        stats.fixedStepOverloaded ? ", surcharge" : ""
+    );
+    SetLine(m_lineCount++, buffer);
+
+    snprintf(
+        buffer, sizeof(buffer), "Objets : %d (visibles %d, inactifs %d) - Corps : %d",
+        stats.objectCount, stats.visibleCount, stats.disabledCount, stats.bodyCount
+    );
+    SetLine(m_lineCount++, buffer);
+
+    if (AllocTracker::IsEnabled())
+    {
+        snprintf(
+            buffer, sizeof(buffer), "Allocations : %llu (%llu o)",
+            (unsigned long long)AllocTracker::GetFrameAllocCount(),
+            (unsigned long long)AllocTracker::GetFrameAllocBytes()
+        );
+        SetLine(m_lineCount++, buffer);
+    }
+
+    for (const ProfilerZoneStats &zone : Profiler::GetZoneStats())
+    {
+        snprintf(
+            buffer, sizeof(buffer), "%s : %.3f ms (x%d)",
+            zone.name, zone.avgMs, zone.callCount
+        );
+        SetLine(m_lineCount++, buffer);
+    }
+}
+
+uint64_t UIProfilerOverlay::GetRenderHash()
+{
+    uint64_t hash = UIObject::GetRenderHash();
+    hash = UIHashCombine(hash, (uint64_t)m_lineCount);
+    for (int i = 0; i < m_lineCount; i++)
+    {
+        hash = UIHashCombine(hash, (uint64_t)std::hash<std::string>()(m_lines[i]->GetString()));
+    }
+    return hash;
+}
+
+void UIProfilerOverlay::SetLine(int index, const std::string &str)
+{
+    if (index < (int)m_lines.size())
+    {
+        m_lines[index]->SetString(str);
+        return;
+    }
+
+    SDL_Color color = { 255, 255, 255, 255 };
+    Text *line = new Text(g_renderer, m_font, str, color);
+    AssertNew(line);
+    m_lines.push_back(line);
+}
+
+void UIProfilerOverlay::Render()
+{
+    if (IsUIEnabled() == false) return;
+
+    // Calcule la taille du fond
+    float width = 0.f;
+    float height = 0.f;
+    for (int i = 0; i < m_lineCount; i++)
+    {
+        int w = 0, h = 0;
+        SDL_QueryTexture(m_lines[i]->GetTexture(), NULL, NULL, &w, &h);
+        width = std::max(width, (float)w);
+        height += (float)h;
+    }
+
+    SDL_FRect background = {
+        0.5f * OVERLAY_MARGIN, 0.5f * OVERLAY_MARGIN,
+        width + OVERLAY_MARGIN, height + OVERLAY_MARGIN
+    };
+    SDL_SetRenderDrawColor(g_renderer, 0, 0, 0, 160);
+    SDL_RenderFillRectF(g_renderer, &background);
+
+    float y = OVERLAY_MARGIN;
+    for (int i = 0; i < m_lineCount; i++)
+    {
+        SDL_Texture *texture = m_lines[i]->GetTexture();
+        int w = 0, h = 0;
+        SDL_QueryTexture(texture, NULL, NULL, &w, &h);
+
+        SDL_FRect dstRect = { OVERLAY_MARGIN, y, (float)w, (float)h };
+        SDL_RenderCopyF(g_renderer, texture, NULL, &dstRect);
+        y += (float)h;
+    }
+}
@@ -0,0 +1,43 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+#include "UIObject.h"
+#include "Text.h"
+
+/// @brief Affichage de debug des mesures du profileur et des statistiques
+/// de la scne, dessin en haut  gauche de l'cran.
+class UIProfilerOverlay : public UIObject
+{
+public:
+    UIProfilerOverlay(Scene *scene, TTF_Font *font);
+    virtual ~UIProfilerOverlay();
+
+    virtual void Update() override;
+    virtual void Render() override;
+    virtual uint64_t GetRenderHash() override;
+
+    /// @brief Dfinit la priode de rafrachissement des textes.
+    /// @param period la priode en secondes.
+    void SetRefreshPeriod(float period);
+
+private:
+    void RefreshLines();
+    void SetLine(int index, const std::string &str);
+
+    TTF_Font *m_font;
+    std::vector<Text *> m_lines;
+    int m_lineCount;
+    float m_refreshPeriod;
+    float m_refreshAccu;
+};
+
+inline void UIProfilerOverlay::SetRefreshPeriod(float period)
+{
+    m_refreshPeriod = period;
+}
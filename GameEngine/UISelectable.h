@@ -120,10 +120,12 @@ inline UISelectableGroup *UISelectable::GetGroup()
 inline void UISelectable::SetLocalNavigationRect(const UIRect &rect)
 {
     m_autoNavRect = rect;
+    InvalidateLayout();
 }
 
 inline UIRect &UISelectable::GetLocalNavigationRect()
 {
+    InvalidateLayout();
     return m_autoNavRect;
 }
 
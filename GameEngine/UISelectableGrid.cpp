@@ -0,0 +1,243 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "UISelectableGrid.h"
+#include "UISelectable.h"
+#include "Utils.h"
+
+#define UI_GRID_MAX_SIZE 64
+
+UISelectableGrid::UISelectableGrid() :
+    m_entries(), m_cellStarts(), m_cellItems(), m_bounds{ 0.f, 0.f, 0.f, 0.f },
+    m_cellW(1.f), m_cellH(1.f), m_colCount(0), m_rowCount(0)
+{
+}
+
+void UISelectableGrid::Clear()
+{
+    m_entries.clear();
+    m_cellStarts.clear();
+    m_cellItems.clear();
+    m_bounds = SDL_FRect{ 0.f, 0.f, 0.f, 0.f };
+    m_cellW = 1.f;
+    m_cellH = 1.f;
+    m_colCount = 0;
+    m_rowCount = 0;
+}
+
+static SDL_FRect UISelectableGrid_GetEntryBounds(const SDL_FRect &a, const SDL_FRect &b)
+{
+    const float lowerX = fminf(a.x, b.x);
+    const float lowerY = fminf(a.y, b.y);
+    const float upperX = fmaxf(a.x + a.w, b.x + b.w);
+    const float upperY = fmaxf(a.y + a.h, b.y + b.h);
+    return SDL_FRect{ lowerX, lowerY, upperX - lowerX, upperY - lowerY };
+}
+
+void UISelectableGrid::Build(const std::set<UISelectable *> &selectables)
+{
+    Clear();
+    if (selectables.empty()) return;
+
+    float lowerX = INFINITY, lowerY = INFINITY;
+    float upperX = -INFINITY, upperY = -INFINITY;
+
+    m_entries.reserve(selectables.size());
+    for (UISelectable *selectable : selectables)
+    {
+        Entry entry = { 0 };
+        entry.selectable = selectable;
+        entry.canvasRect = selectable->GetCanvasRect();
+        entry.navRect = selectable->GetCanvasNavigationRect();
+        m_entries.push_back(entry);
+
+        SDL_FRect rect = UISelectableGrid_GetEntryBounds(entry.canvasRect, entry.navRect);
+        lowerX = fminf(lowerX, rect.x);
+        lowerY = fminf(lowerY, rect.y);
+        upperX = fmaxf(upperX, rect.x + rect.w);
+        upperY = fmaxf(upperY, rect.y + rect.h);
+    }
+    m_bounds = SDL_FRect{ lowerX, lowerY, upperX - lowerX, upperY - lowerY };
+
+    // Environ un lment par cellule, avec des cellules proches d'un carr
+    const int count = (int)m_entries.size();
+    const float width = fmaxf(m_bounds.w, 1.f);
+    const float height = fmaxf(m_bounds.h, 1.f);
+    m_colCount = Math::Clamp((int)ceilf(sqrtf((float)count * width / height)), 1, UI_GRID_MAX_SIZE);
+    m_rowCount = Math::Clamp((int)ceilf((float)count / (float)m_colCount), 1, UI_GRID_MAX_SIZE);
+    m_cellW = width / (float)m_colCount;
+    m_cellH = height / (float)m_rowCount;
+
+    // Listes des cellules ranges  la suite (comptage puis remplissage)
+    const int cellCount = m_colCount * m_rowCount;
+    m_cellStarts.assign(cellCount + 1, 0);
+    for (const Entry &entry : m_entries)
+    {
+        int col0, row0, col1, row1;
+        GetCellRange(UISelectableGrid_GetEntryBounds(entry.canvasRect, entry.navRect), col0, row0, col1, row1);
+        for (int row = row0; row <= row1; row++)
+        {
+            for (int col = col0; col <= col1; col++)
+            {
+                m_cellStarts[row * m_colCount + col + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < cellCount; i++)
+    {
+        m_cellStarts[i + 1] += m_cellStarts[i];
+    }
+
+    m_cellItems.resize(m_cellStarts[cellCount]);
+    std::vector<int> cellEnds(m_cellStarts.begin(), m_cellStarts.end() - 1);
+    for (int i = 0; i < count; i++)
+    {
+        const Entry &entry = m_entries[i];
+        int col0, row0, col1, row1;
+        GetCellRange(UISelectableGrid_GetEntryBounds(entry.canvasRect, entry.navRect), col0, row0, col1, row1);
+        for (int row = row0; row <= row1; row++)
+        {
+            for (int col = col0; col <= col1; col++)
+            {
+                // Les indices de chaque cellule restent croissants
+                m_cellItems[cellEnds[row * m_colCount + col]++] = i;
+            }
+        }
+    }
+}
+
+void UISelectableGrid::GetCellRange(
+    const SDL_FRect &rect, int &col0, int &row0, int &col1, int &row1) const
+{
+    col0 = Math::Clamp((int)floorf((rect.x - m_bounds.x) / m_cellW), 0, m_colCount - 1);
+    row0 = Math::Clamp((int)floorf((rect.y - m_bounds.y) / m_cellH), 0, m_rowCount - 1);
+    col1 = Math::Clamp((int)floorf((rect.x + rect.w - m_bounds.x) / m_cellW), 0, m_colCount - 1);
+    row1 = Math::Clamp((int)floorf((rect.y + rect.h - m_bounds.y) / m_cellH), 0, m_rowCount - 1);
+}
+
+int UISelectableGrid::QueryPoint(const SDL_FPoint &point) const
+{
+    if (m_entries.empty()) return -1;
+    if ((point.x < m_bounds.x) || (point.x > m_bounds.x + m_bounds.w) ||
+        (point.y < m_bounds.y) || (point.y > m_bounds.y + m_bounds.h))
+    {
+        return -1;
+    }
+
+    const int col = Math::Clamp((int)floorf((point.x - m_bounds.x) / m_cellW), 0, m_colCount - 1);
+    const int row = Math::Clamp((int)floorf((point.y - m_bounds.y) / m_cellH), 0, m_rowCount - 1);
+    const int cell = row * m_colCount + col;
+
+    for (int i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; i++)
+    {
+        const SDL_FRect &rect = m_entries[m_cellItems[i]].canvasRect;
+        if ((point.x >= rect.x) && (point.x <= rect.x + rect.w) &&
+            (point.y >= rect.y) && (point.y <= rect.y + rect.h))
+        {
+            return m_cellItems[i];
+        }
+    }
+    return -1;
+}
+
+bool UISelectableGrid::TestDirection(int index, int other, Direction direction, float &score) const
+{
+    const SDL_FRect &currRect = m_entries[index].navRect;
+    const SDL_FRect &nextRect = m_entries[other].navRect;
+
+    b2Vec2 dist = SDL_FRectDistance(currRect, nextRect);
+    dist.x = fmaxf(dist.x, 0.f);
+    dist.y = fmaxf(dist.y, 0.f);
+
+    switch (direction)
+    {
+    case Direction::RIGHT:
+        score = dist.x + 10.f * dist.y;
+        return (currRect.x + currRect.w < nextRect.x);
+
+    case Direction::LEFT:
+        score = dist.x + 10.f * dist.y;
+        return (currRect.x > nextRect.x + nextRect.w);
+
+    case Direction::UP:
+        score = dist.y + 10.f * dist.x;
+        return (currRect.y > nextRect.y + nextRect.h);
+
+    case Direction::DOWN:
+    default:
+        score = dist.y + 10.f * dist.x;
+        return (currRect.y + currRect.h < nextRect.y);
+    }
+}
+
+int UISelectableGrid::QueryDirection(int index, Direction direction) const
+{
+    if (index < 0 || index >= (int)m_entries.size()) return -1;
+
+    int col0, row0, col1, row1;
+    GetCellRange(m_entries[index].navRect, col0, row0, col1, row1);
+
+    // Seules les cellules situes du ct de la direction sont parcourues
+    int minCol = 0, maxCol = m_colCount - 1;
+    int minRow = 0, maxRow = m_rowCount - 1;
+    switch (direction)
+    {
+    case Direction::RIGHT: minCol = col1; break;
+    case Direction::LEFT:  maxCol = col0; break;
+    case Direction::UP:    maxRow = row0; break;
+    case Direction::DOWN:  minRow = row1; break;
+    default: break;
+    }
+
+    const float cellSize = fminf(m_cellW, m_cellH);
+    const int ringCount = std::max(m_colCount, m_rowCount);
+
+    int best = -1;
+    float bestScore = INFINITY;
+    for (int k = 0; k <= ringCount; k++)
+    {
+        // Un lment rencontr pour la premire fois dans l'anneau k
+        // est  une distance d'au moins (k - 1) cellules du dpart,
+        // et le score est suprieur  cette distance
+        if (best >= 0 && bestScore < (float)(k - 1) * cellSize) break;
+
+        const int colA = col0 - k, colB = col1 + k;
+        const int rowA = row0 - k, rowB = row1 + k;
+        const int rowMin = std::max(rowA, minRow), rowMax = std::min(rowB, maxRow);
+        for (int row = rowMin; row <= rowMax; row++)
+        {
+            // Au premier anneau, tout le bloc de dpart est parcouru,
+            // ensuite seulement le bord de l'anneau
+            const bool fullRow = (k == 0) || (row == rowA) || (row == rowB);
+            const int colStep = fullRow ? 1 : colB - colA;
+            for (int col = colA; col <= colB; col += colStep)
+            {
+                if (col < minCol || col > maxCol) continue;
+
+                const int cell = row * m_colCount + col;
+                for (int i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; i++)
+                {
+                    const int other = m_cellItems[i];
+                    if (other == index) continue;
+
+                    float score = 0.f;
+                    if (TestDirection(index, other, direction, score) == false) continue;
+
+                    // A galit, le premier lment de l'ensemble est choisi
+                    if ((score < bestScore) || (score == bestScore && other < best))
+                    {
+                        bestScore = score;
+                        best = other;
+                    }
+                }
+            }
+        }
+
+        if (colA <= 0 && colB >= m_colCount - 1 && rowA <= 0 && rowB >= m_rowCount - 1)
+            break;
+    }
+    return best;
+}
@@ -0,0 +1,98 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Settings.h"
+
+class UISelectable;
+
+/// @brief Index spatial des rectangles d'un ensemble de UISelectable.
+/// Les rectangles sont rangs dans une grille uniforme couvrant leur bote
+/// englobante. On trouve ainsi l'lment sous un point ou le voisin le plus
+/// proche dans une direction en ne parcourant que quelques cellules.
+class UISelectableGrid
+{
+public:
+    UISelectableGrid();
+
+    enum class Direction : int
+    {
+        UP, DOWN, LEFT, RIGHT
+    };
+
+    /// @brief Calcule les rectangles des lments et remplit la grille.
+    /// Les lments sont numrots dans l'ordre de l'ensemble.
+    /// @param selectables l'ensemble des lments  indexer.
+    void Build(const std::set<UISelectable *> &selectables);
+    void Clear();
+
+    int GetCount() const;
+    UISelectable *GetSelectable(int index) const;
+    const SDL_FRect &GetCanvasRect(int index) const;
+    const SDL_FRect &GetNavigationRect(int index) const;
+
+    /// @brief Renvoie le premier lment dont le rectangle contient le point.
+    /// @param point le point dans le repre du canvas.
+    /// @return L'indice de l'lment ou -1 si aucun ne contient le point.
+    int QueryPoint(const SDL_FPoint &point) const;
+
+    /// @brief Renvoie le voisin le plus proche d'un lment dans une direction.
+    /// Le score et le dpartage sont ceux de la recherche exhaustive :
+    /// distance dans la direction plus dix fois la distance transverse,
+    ///  galit le premier lment de l'ensemble.
+    /// @param index l'indice de l'lment de dpart.
+    /// @param direction la direction de navigation.
+    /// @return L'indice du voisin ou -1 s'il n'y en a pas.
+    int QueryDirection(int index, Direction direction) const;
+
+private:
+    struct Entry
+    {
+        UISelectable *selectable;
+        SDL_FRect canvasRect;
+        SDL_FRect navRect;
+    };
+
+    void GetCellRange(const SDL_FRect &rect, int &col0, int &row0, int &col1, int &row1) const;
+    bool TestDirection(int index, int other, Direction direction, float &score) const;
+
+    std::vector<Entry> m_entries;
+
+    /// @brief Dbut de la liste de chaque cellule dans m_cellItems.
+    /// La liste de la cellule i est [m_cellStarts[i], m_cellStarts[i + 1]).
+    std::vector<int> m_cellStarts;
+    std::vector<int> m_cellItems;
+
+    SDL_FRect m_bounds;
+    float m_cellW;
+    float m_cellH;
+    int m_colCount;
+    int m_rowCount;
+};
+
+inline int UISelectableGrid::GetCount() const
+{
+    return (int)m_entries.size();
+}
+
+inline UISelectable *UISelectableGrid::GetSelectable(int index) const
+{
+    assert(0 <= index && index < (int)m_entries.size());
+    return m_entries[index].selectable;
+}
+
+inline const SDL_FRect &UISelectableGrid::GetCanvasRect(int index) const
+{
+    assert(0 <= index && index < (int)m_entries.size());
+    return m_entries[index].canvasRect;
+}
+
+inline const SDL_FRect &UISelectableGrid::GetNavigationRect(int index) const
+{
+    assert(0 <= index && index < (int)m_entries.size());
+    return m_entries[index].navRect;
+}
@@ -11,7 +11,8 @@
 
 UISelectableGroup::UISelectableGroup(Scene *scene) :
     GameObject(scene, DEFAULT_UI_LAYER), m_interactable(false), m_navigationEnabled(false),
-    m_selected(nullptr), m_updateID(0), m_canceled(false), m_cursor(nullptr)
+    m_selected(nullptr), m_updateID(0), m_canceled(false), m_cursor(nullptr),
+    m_grid(), m_gridLayoutVersion(0), m_gridValid(false)
 {
     SetName("UISelectableGroup");
 }
@@ -153,6 +154,23 @@ void UISelectableGroup::Update()
 
     for (const UIInput *input : m_inputs)
     {
+        bool validatePressed = input->validatePressed;
+        bool validateReleased = input->validateReleased;
+
+        if (input->pointerMoved || input->pointerPressed || input->pointerReleased)
+        {
+            UISelectable *pointed = GetSelectableAt(input->pointerPos);
+            if (pointed && pointed->IsUIEnabled())
+            {
+                SetSelected(pointed, true);
+            }
+            if (pointed && pointed == m_selected)
+            {
+                validatePressed |= input->pointerPressed;
+                validateReleased |= input->pointerReleased;
+            }
+        }
+
         if (m_selected && input->up && m_selected->GetOnUp())
         {
             SetSelected(m_selected->GetOnUp(), true);
@@ -170,7 +188,7 @@ void UISelectableGroup::Update()
             SetSelected(m_selected->GetOnRight(), true);
         }
 
-        if (m_selected && input->validatePressed)
+        if (m_selected && validatePressed)
         {
             m_selected->SetState(UISelectable::State::PRESSED, true);
             if (m_selected->IsClickedOnRelease() == false)
@@ -178,7 +196,7 @@ void UISelectableGroup::Update()
                 m_selected->OnClick();
             }
         }
-        if (m_selected && input->validateReleased)
+        if (m_selected && validateReleased)
         {
             if (m_selected->IsClickedOnRelease() &&
                 m_selected->GetState() == UISelectable::State::PRESSED)
@@ -216,6 +234,7 @@ void UISelectableGroup::AddSelectable(UISelectable *selectable)
         prevGroup->RemoveSelectable(selectable);
     }
     m_selectableSet.insert(selectable);
+    m_gridValid = false;
     selectable->m_group = this;
     selectable->SetState(UISelectable::State::NORMAL);
 }
@@ -226,6 +245,7 @@ void UISelectableGroup::RemoveSelectable(UISelectable *selectable)
     if (ContainsSelectable(selectable) == false) return;
 
     m_selectableSet.erase(selectable);
+    m_gridValid = false;
     for (UISelectable *other : m_selectableSet)
     {
         if (other->m_nextDown == selectable)
@@ -266,6 +286,7 @@ void UISelectableGroup::RemoveAllSelectables()
         selectable->m_group = nullptr;
     }
     m_selectableSet.clear();
+    m_gridValid = false;
 }
 
 void UISelectableGroup::RemoveAllUnselected()
@@ -284,63 +305,46 @@ void UISelectableGroup::RemoveAllUnselected()
     }
     m_selectableSet.clear();
     if (m_selected) m_selectableSet.insert(m_selected);
+    m_gridValid = false;
 }
 
-void UISelectableGroup::ComputeAutoNavigation()
+void UISelectableGroup::UpdateGrid()
 {
-    std::map<UISelectable*, SDL_FRect> rectMap;
+    const Uint64 layoutVersion = UIObject::GetLayoutVersion();
+    if (m_gridValid && m_gridLayoutVersion == layoutVersion) return;
 
-    for (UISelectable *selectable : m_selectableSet)
-    {
-        rectMap[selectable] = selectable->GetCanvasNavigationRect();
-    }
+    m_grid.Build(m_selectableSet);
+    m_gridLayoutVersion = layoutVersion;
+    m_gridValid = true;
+}
 
-    for (UISelectable *currSelectable : m_selectableSet)
-    {
-        SDL_FRect currRect = rectMap[currSelectable];
+UISelectable *UISelectableGroup::GetSelectableAt(const SDL_FPoint &point)
+{
+    UpdateGrid();
 
-        UISelectable *nextR = nullptr;
-        UISelectable *nextL = nullptr;
-        UISelectable *nextU = nullptr;
-        UISelectable *nextD = nullptr;
+    const int index = m_grid.QueryPoint(point);
+    return (index >= 0) ? m_grid.GetSelectable(index) : nullptr;
+}
 
-        float distR = INFINITY;
-        float distL = INFINITY;
-        float distU = INFINITY;
-        float distD = INFINITY;
+void UISelectableGroup::ComputeAutoNavigation()
+{
+    UpdateGrid();
 
-        for (UISelectable *nextSelectable : m_selectableSet)
-        {
-            if (nextSelectable == currSelectable) continue;
-
-            SDL_FRect nextRect = rectMap[nextSelectable];
-            b2Vec2 dist = SDL_FRectDistance(currRect, nextRect);
-            dist.x = fmaxf(dist.x, 0.f);
-            dist.y = fmaxf(dist.y, 0.f);
-            float xDist = dist.x + 10.f * dist.y;
-            float yDist = dist.y + 10.f * dist.x;
-
-            if ((currRect.x + currRect.w < nextRect.x) && (xDist < distR))
-            {   
-                distR = xDist; nextR = nextSelectable;
-            }
-            if ((currRect.x > nextRect.x + nextRect.w) && (xDist < distL))
-            {
-                distL = xDist; nextL = nextSelectable;
-            }
-            if ((currRect.y > nextRect.y + nextRect.h) && (yDist < distU))
-            {
-                distU = yDist; nextU = nextSelectable;
-            }
-            if ((currRect.y + currRect.h < nextRect.y) && (yDist < distD))
-            {
-                distD = yDist; nextD = nextSelectable;
-            }
-        }
+    // Chaque voisin est cherché dans les cellules proches de l'index
+    // plutôt que parmi tous les éléments du groupe
+    auto getNext = [this](int index, UISelectableGrid::Direction direction)
+    {
+        const int next = m_grid.QueryDirection(index, direction);
+        return (next >= 0) ? m_grid.GetSelectable(next) : nullptr;
+    };
 
-        currSelectable->m_nextUp = nextU;
-        currSelectable->m_nextDown = nextD;
-        currSelectable->m_nextLeft = nextL;
-        currSelectable->m_nextRight = nextR;
+    const int count = m_grid.GetCount();
+    for (int i = 0; i < count; i++)
+    {
+        UISelectable *currSelectable = m_grid.GetSelectable(i);
+        currSelectable->m_nextUp = getNext(i, UISelectableGrid::Direction::UP);
+        currSelectable->m_nextDown = getNext(i, UISelectableGrid::Direction::DOWN);
+        currSelectable->m_nextLeft = getNext(i, UISelectableGrid::Direction::LEFT);
+        currSelectable->m_nextRight = getNext(i, UISelectableGrid::Direction::RIGHT);
     }
 }
@@ -9,6 +9,7 @@
 #include "Settings.h"
 #include "UIObject.h"
 #include "UIInput.h"
+#include "UISelectableGrid.h"
 
 class UISelectable;
 class UISelectableListener;
@@ -44,6 +45,13 @@ public:
     void RemoveAllUnselected();
     void ComputeAutoNavigation();
 
+    /// @brief Renvoie l'élément du groupe sous un point du canvas.
+    /// La recherche utilise un index spatial des rectangles des éléments,
+    /// reconstruit uniquement lorsque la disposition de l'interface change.
+    /// @param point le point dans le repère du canvas (par exemple la souris).
+    /// @return L'élément sous le point ou nullptr.
+    UISelectable *GetSelectableAt(const SDL_FPoint &point);
+
     void SetCursor(UIObject *object);
     void SetCursorOnSelected();
     UIObject *GetCursor();
@@ -60,6 +68,7 @@ protected:
 private:
     void SetCursorTarget();
     void SelectEnabledSelectable();
+    void UpdateGrid();
 
     UIObject *m_cursor;
     bool m_interactable;
@@ -68,6 +77,12 @@ private:
 
     bool m_canceled;
     UISelectable *m_selected;
+
+    /// @brief Index spatial des éléments et version de la disposition
+    /// de l'interface au moment de sa construction.
+    UISelectableGrid m_grid;
+    Uint64 m_gridLayoutVersion;
+    bool m_gridValid;
 };
 
 inline void UISelectableGroup::SetCursor(UIObject *object)
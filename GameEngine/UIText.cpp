@@ -95,6 +95,16 @@ void UIText::Update()
     m_text.SetColor(GetColor().ToSDL());
 }
 
+uint64_t UIText::GetRenderHash()
+{
+    uint64_t hash = UIObject::GetRenderHash();
+    hash = UIHashCombine(hash, (uint64_t)std::hash<std::string>()(m_text.GetString()));
+    hash = UIHashCombine(hash, (const void *)m_text.GetTexture());
+    hash = UIHashCombine(hash, (uint64_t)m_renderMode);
+    hash = UIHashCombine(hash, (uint64_t)m_anchor);
+    return hash;
+}
+
 void UIText::GetNativePixelSize(int &pixelWidth, int &pixelHeight) const
 {
     pixelWidth = m_pixelW;
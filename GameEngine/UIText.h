@@ -34,6 +34,7 @@ public:
 
     virtual void Render() override;
     virtual void Update() override;
+    virtual uint64_t GetRenderHash() override;
 
 protected:
     RenderMode m_renderMode;
@@ -27,6 +27,9 @@ void ApplicationInput::OnPreEventProcess()
         input.validateReleased = false;
         input.cancel = false;
         input.start = false;
+        input.pointerMoved = false;
+        input.pointerPressed = false;
+        input.pointerReleased = false;
     }
 }
 
@@ -112,6 +115,27 @@ void ApplicationInput::OnEventProcess(SDL_Event evt)
         }
         break;
 
+    case SDL_MOUSEMOTION:
+        uiInputs[0].pointerMoved = true;
+        uiInputs[0].pointerPos = SDL_FPoint{ (float)evt.motion.x, (float)evt.motion.y };
+        break;
+
+    case SDL_MOUSEBUTTONDOWN:
+        if (evt.button.button != SDL_BUTTON_LEFT)
+            break;
+
+        uiInputs[0].pointerPressed = true;
+        uiInputs[0].pointerPos = SDL_FPoint{ (float)evt.button.x, (float)evt.button.y };
+        break;
+
+    case SDL_MOUSEBUTTONUP:
+        if (evt.button.button != SDL_BUTTON_LEFT)
+            break;
+
+        uiInputs[0].pointerReleased = true;
+        uiInputs[0].pointerPos = SDL_FPoint{ (float)evt.button.x, (float)evt.button.y };
+        break;
+
     case SDL_QUIT:
         quitPressed = true;
         break;
@@ -202,6 +226,9 @@ void ApplicationInput::Reset()
         input.validateReleased = false;
         input.cancel = false;
         input.start = false;
+        input.pointerMoved = false;
+        input.pointerPressed = false;
+        input.pointerReleased = false;
     }
 }
 
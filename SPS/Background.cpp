@@ -9,14 +9,20 @@
 
 Background::Background(Scene *scene, int layer) :
     GameObject(scene, layer),
-    m_layers(), m_layerModes(), m_shiftFactors(),
-    m_worldDim(b2Vec2(1.f, 1.f)), m_worldCenter(b2Vec2_zero)
+    m_layers(),
+    m_worldDim(b2Vec2(1.f, 1.f)), m_worldCenter(b2Vec2_zero),
+    m_logicalW(0), m_logicalH(0), m_layerW(0.f), m_layerH(0.f),
+    m_cacheEnabled(true), m_cacheValid(false), m_cacheTexture(nullptr),
+    m_cacheWidth(0), m_cacheHeight(0), m_cacheKey(0), m_prevKey(0), m_stillFrameCount(0),
+    m_renderResetCount(Game_GetRenderResetCount())
 {
     SetName("Background");
 }
 
 Background::~Background()
 {
+    ReleaseCacheTexture();
+    ReleaseWrapTextures();
 }
 
 void Background::Update()
@@ -29,119 +35,407 @@ void Background::Render()
     Camera *camera = m_scene->GetActiveCamera();
     AssertNew(camera);
 
+    // Le contenu des textures cibles a t perdu
+    if (m_renderResetCount != Game_GetRenderResetCount())
+    {
+        m_renderResetCount = Game_GetRenderResetCount();
+        ReleaseCacheTexture();
+        ReleaseWrapTextures();
+    }
+
+    const uint64_t key = ComputeLayout(camera);
+    UpdateWrapTextures();
+
+    // Le cache n'est utilis que lorsque la camra est immobile,
+    // sinon il ajouterait une copie plein cran  chaque frame
+    m_stillFrameCount = (key == m_prevKey) ? m_stillFrameCount + 1 : 0;
+    m_prevKey = key;
+
+    if (m_cacheEnabled == false || m_stillFrameCount < 2 || UpdateCacheTexture() == false)
+    {
+        DrawLayers();
+        return;
+    }
+
+    if (m_cacheValid == false || key != m_cacheKey)
+    {
+        SDL_Texture *target = SDL_GetRenderTarget(g_renderer);
+        float scaleX = 1.f, scaleY = 1.f;
+        SDL_RenderGetScale(g_renderer, &scaleX, &scaleY);
+
+        SDL_SetRenderTarget(g_renderer, m_cacheTexture);
+        SDL_RenderSetScale(g_renderer, scaleX, scaleY);
+        SDL_SetRenderDrawColor(g_renderer, 0, 0, 0, 0);
+        SDL_RenderClear(g_renderer);
+
+        DrawLayers();
+
+        SDL_SetRenderTarget(g_renderer, target);
+
+        m_cacheKey = key;
+        m_cacheValid = true;
+    }
+
+    SDL_RenderCopy(g_renderer, m_cacheTexture, NULL, NULL);
+}
+
+void Background::AddLayer(SDL_Texture *texture, b2Vec2 shiftFactor, RenderMode mode)
+{
+    int textureW = 0, textureH = 0;
+    if (texture)
+    {
+        SDL_QueryTexture(texture, nullptr, nullptr, &textureW, &textureH);
+    }
+
+    Layer layer;
+    layer.texture = texture;
+    layer.shiftFactor = shiftFactor;
+    layer.mode = mode;
+    layer.textureW = textureW;
+    layer.textureH = textureH;
+    layer.topRow = SDL_Rect{ 0, 0, textureW, 1 };
+    layer.bottomRow = SDL_Rect{ 0, textureH - 1, textureW, 1 };
+    layer.x = 0.f;
+    layer.y = 0.f;
+    layer.tileCount = 0;
+    layer.wrapTexture = nullptr;
+    layer.wrapEnabled = true;
+    layer.wrapTileCount = 0;
+    layer.wrapFillAbove = 0;
+    layer.wrapFillBelow = 0;
+    m_layers.push_back(layer);
+}
+
+SDL_Texture *Background::CreateTarget(int width, int height)
+{
+    SDL_RendererInfo info = { 0 };
+    SDL_GetRendererInfo(g_renderer, &info);
+    if ((info.flags & SDL_RENDERER_TARGETTEXTURE) == 0 || width <= 0 || height <= 0)
+    {
+        return nullptr;
+    }
+
+    SDL_Texture *texture = SDL_CreateTexture(
+        g_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height
+    );
+    if (texture == nullptr)
+    {
+        std::cout << "WARNING - Background target texture: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // Les calques sont dessins en alpha prmultipli
+    SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+        SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD
+    );
+    if (SDL_SetTextureBlendMode(texture, premultiplied) != 0)
+    {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+    return texture;
+}
+
+void Background::ReleaseCacheTexture()
+{
+    if (m_cacheTexture) SDL_DestroyTexture(m_cacheTexture);
+    m_cacheTexture = nullptr;
+    m_cacheValid = false;
+}
+
+void Background::ReleaseWrapTextures()
+{
+    for (Layer &layer : m_layers)
+    {
+        if (layer.wrapTexture) SDL_DestroyTexture(layer.wrapTexture);
+        layer.wrapTexture = nullptr;
+        layer.wrapTileCount = 0;
+    }
+}
+
+uint64_t Background::ComputeLayout(Camera *camera)
+{
+    SDL_RenderGetLogicalSize(g_renderer, &m_logicalW, &m_logicalH);
+    if (m_logicalW <= 0 || m_logicalH <= 0)
+    {
+        SDL_GetRendererOutputSize(g_renderer, &m_logicalW, &m_logicalH);
+    }
+
     b2Vec2 viewCenter = camera->GetWorldView().GetCenter();
 
     // Dimension du fond dans le rfrentiel monde
     float scale = camera->GetWorldToViewScale();
-    float layerW = scale * m_worldDim.x;
-    float layerH = scale * m_worldDim.y;
+    m_layerW = scale * m_worldDim.x;
+    m_layerH = scale * m_worldDim.y;
 
-    int logicalW, logicalH;
-    SDL_RenderGetLogicalSize(g_renderer, &logicalW, &logicalH);
+    uint64_t key = UI_HASH_SEED;
+    key = UIHashCombine(key, (uint64_t)m_logicalW);
+    key = UIHashCombine(key, (uint64_t)m_logicalH);
+    key = UIHashCombine(key, m_layerW);
+    key = UIHashCombine(key, m_layerH);
 
-    // Dessine les diffrents calques du fond (parallax)
-    for (int i = 0; i < m_layers.size(); ++i)
+    for (Layer &layer : m_layers)
     {
-        SDL_Texture *layer = m_layers[i];
-        if (layer == nullptr) continue;
-
-        b2Vec2 shiftFactor = m_shiftFactors[i];
-        RenderMode mode = m_layerModes[i];
-
         b2Vec2 layerWest = viewCenter - m_worldCenter;
-        layerWest.x *= (1.f - shiftFactor.x);
-        layerWest.y *= (1.f - shiftFactor.y);
+        layerWest.x *= (1.f - layer.shiftFactor.x);
+        layerWest.y *= (1.f - layer.shiftFactor.y);
         layerWest += m_worldCenter;
 
         float x, y;
         camera->WorldToView(layerWest, x, y);
-        x = fmodf(x, layerW);
 
-        for (x = x - layerW; x < (float)logicalW; x += layerW)
+        // Premire tuile qui touche l'cran et nombre de tuiles visibles
+        layer.tileCount = 0;
+        if (m_layerW > 0.f)
         {
-            SDL_FRect dstRect = { 0 };
-            dstRect.x = x;
-            dstRect.y = y;
-            dstRect.w = layerW;
-            dstRect.h = layerH;
-
-            switch (mode)
-            {
-            default:
-            case Background::RenderMode::NO_FILL:
-                break;
-            case Background::RenderMode::FILL_ABOVE:
-                FillLayerAbove(layer, dstRect);
-                break;
-            case Background::RenderMode::FILL_BELOW:
-                FillLayerBelow(layer, dstRect);
-                break;
-            case Background::RenderMode::FILL_VERTICAL:
-                FillLayerAbove(layer, dstRect);
-                FillLayerBelow(layer, dstRect);
-                break;
-            }
-            RenderCopyF(g_renderer, layer, NULL, &dstRect, Anchor::WEST);
+            x = fmodf(x, m_layerW);
+            if (x > 0.f) x -= m_layerW;
+            layer.tileCount = (int)ceilf(((float)m_logicalW - x) / m_layerW);
         }
+        layer.x = x;
+        layer.y = y;
+
+        key = UIHashCombine(key, layer.x);
+        key = UIHashCombine(key, layer.y);
     }
+    return key;
 }
 
-void Background::AddLayer(SDL_Texture *texture, b2Vec2 shiftFactor, RenderMode mode)
+bool Background::UpdateCacheTexture()
+{
+    // La texture a la rsolution de sortie pour ne pas flouter le fond
+    float scaleX = 1.f, scaleY = 1.f;
+    SDL_RenderGetScale(g_renderer, &scaleX, &scaleY);
+    const int width = (int)ceilf((float)m_logicalW * scaleX);
+    const int height = (int)ceilf((float)m_logicalH * scaleY);
+
+    if (m_cacheTexture && width == m_cacheWidth && height == m_cacheHeight)
+        return true;
+
+    ReleaseCacheTexture();
+
+    m_cacheTexture = CreateTarget(width, height);
+    if (m_cacheTexture == nullptr)
+    {
+        m_cacheEnabled = false;
+        return false;
+    }
+
+    m_cacheWidth = width;
+    m_cacheHeight = height;
+    return true;
+}
+
+void Background::UpdateWrapTextures()
 {
-    m_layerModes.push_back(mode);
-    m_layers.push_back(texture);
-    m_shiftFactors.push_back(shiftFactor);
+    for (Layer &layer : m_layers)
+    {
+        if (layer.texture && layer.wrapEnabled) UpdateWrapTexture(layer);
+    }
 }
 
-inline void Background::FillLayerAbove(SDL_Texture *layer, SDL_FRect dstRect)
+bool Background::UpdateWrapTexture(Layer &layer)
 {
-    int textureW, textureH;
-    SDL_QueryTexture(layer, nullptr, nullptr, &textureW, &textureH);
+    if (m_layerW <= 0.f || m_layerH <= 0.f || layer.textureW <= 0 || layer.textureH <= 0)
+        return false;
 
-    SDL_Rect srcRect = { 0 };
-    srcRect.x = 0;
-    srcRect.y = 0;
-    srcRect.w = textureW;
-    srcRect.h = 1;
+    // Tuiles ncessaires pour couvrir l'cran quel que soit le dcalage horizontal
+    const int tileCount = (int)ceilf((float)m_logicalW / m_layerW) + 1;
 
-    dstRect.h = dstRect.y - 0.5f * dstRect.h;
-    dstRect.y = 0.f;
+    // Lignes de remplissage ncessaires pour couvrir l'cran, en texels
+    const int fillH = (int)ceilf((float)m_logicalH * (float)layer.textureH / m_layerH);
+    const bool fillAbove =
+        layer.mode == RenderMode::FILL_ABOVE || layer.mode == RenderMode::FILL_VERTICAL;
+    const bool fillBelow =
+        layer.mode == RenderMode::FILL_BELOW || layer.mode == RenderMode::FILL_VERTICAL;
+    const int fillAboveH = fillAbove ? fillH : 0;
+    const int fillBelowH = fillBelow ? fillH : 0;
 
-    if (dstRect.h > 0.f)
+    if (layer.wrapTexture && tileCount == layer.wrapTileCount &&
+        fillAboveH == layer.wrapFillAbove && fillBelowH == layer.wrapFillBelow)
+    {
+        return true;
+    }
+
+    if (layer.wrapTexture) SDL_DestroyTexture(layer.wrapTexture);
+    layer.wrapTexture = nullptr;
+    layer.wrapTileCount = 0;
+
+    const int width = tileCount * layer.textureW;
+    const int height = fillAboveH + layer.textureH + fillBelowH;
+
+    SDL_RendererInfo info = { 0 };
+    SDL_GetRendererInfo(g_renderer, &info);
+    if ((info.max_texture_width > 0 && width > info.max_texture_width) ||
+        (info.max_texture_height > 0 && height > info.max_texture_height))
+    {
+        return false;
+    }
+
+    layer.wrapTexture = CreateTarget(width, height);
+    if (layer.wrapTexture == nullptr)
+    {
+        layer.wrapEnabled = false;
+        return false;
+    }
+
+    SDL_ScaleMode scaleMode = SDL_ScaleModeNearest;
+    if (SDL_GetTextureScaleMode(layer.texture, &scaleMode) == 0)
+    {
+        SDL_SetTextureScaleMode(layer.wrapTexture, scaleMode);
+    }
+
+    layer.wrapTileCount = tileCount;
+    layer.wrapFillAbove = fillAboveH;
+    layer.wrapFillBelow = fillBelowH;
+
+    // Compose les tuiles et les lignes de remplissage une seule fois
+    SDL_Texture *target = SDL_GetRenderTarget(g_renderer);
+    float scaleX = 1.f, scaleY = 1.f;
+    SDL_RenderGetScale(g_renderer, &scaleX, &scaleY);
+
+    SDL_SetRenderTarget(g_renderer, layer.wrapTexture);
+    SDL_RenderSetScale(g_renderer, 1.f, 1.f);
+    SDL_SetRenderDrawColor(g_renderer, 0, 0, 0, 0);
+    SDL_RenderClear(g_renderer);
+
+    for (int i = 0; i < tileCount; i++)
+    {
+        const int x = i * layer.textureW;
+        SDL_Rect dstRect = { x, fillAboveH, layer.textureW, layer.textureH };
+        SDL_RenderCopy(g_renderer, layer.texture, NULL, &dstRect);
+
+        if (fillAboveH > 0)
+        {
+            dstRect = SDL_Rect{ x, 0, layer.textureW, fillAboveH };
+            SDL_RenderCopy(g_renderer, layer.texture, &layer.topRow, &dstRect);
+        }
+        if (fillBelowH > 0)
+        {
+            dstRect = SDL_Rect{ x, fillAboveH + layer.textureH, layer.textureW, fillBelowH };
+            SDL_RenderCopy(g_renderer, layer.texture, &layer.bottomRow, &dstRect);
+        }
+    }
+
+    SDL_SetRenderTarget(g_renderer, target);
+    SDL_RenderSetScale(g_renderer, scaleX, scaleY);
+    return true;
+}
+
+void Background::DrawLayers()
+{
+    // Dessine les diffrents calques du fond (parallax)
+    for (const Layer &layer : m_layers)
     {
-        SDL_RenderCopyF(g_renderer, layer, &srcRect, &dstRect);
+        if (layer.wrapTexture) DrawWrapTexture(layer);
+        else if (layer.texture) DrawLayer(layer, layer.texture);
     }
 }
 
-inline void Background::FillLayerBelow(SDL_Texture *layer, SDL_FRect dstRect)
+void Background::DrawWrapTexture(const Layer &layer)
 {
-    int textureW, textureH;
-    SDL_QueryTexture(layer, nullptr, nullptr, &textureW, &textureH);
+    int wrapW = 0, wrapH = 0;
+    SDL_QueryTexture(layer.wrapTexture, nullptr, nullptr, &wrapW, &wrapH);
+
+    // Texels de la texture de bouclage par pixel logique
+    const float texelsX = (float)layer.textureW / m_layerW;
+    const float texelsY = (float)layer.textureH / m_layerH;
+
+    // Position  l'cran de l'origine de la texture de bouclage
+    const float originX = layer.x;
+    const float originY = layer.y - 0.5f * m_layerH - (float)layer.wrapFillAbove / texelsY;
+
+    // Texels visibles, arrondis aux texels entiers
+    const int u0 = std::max(0, (int)floorf(-originX * texelsX));
+    const int u1 = std::min(wrapW, (int)ceilf(((float)m_logicalW - originX) * texelsX));
+    const int v0 = std::max(0, (int)floorf(-originY * texelsY));
+    const int v1 = std::min(wrapH, (int)ceilf(((float)m_logicalH - originY) * texelsY));
+    if (u1 <= u0 || v1 <= v0)
+        return;
+
+    SDL_Rect srcRect = { u0, v0, u1 - u0, v1 - v0 };
+
+    float y0 = originY + (float)v0 / texelsY;
+    float y1 = originY + (float)v1 / texelsY;
 
-    int logicalW, logicalH;
-    SDL_RenderGetLogicalSize(g_renderer, &logicalW, &logicalH);
+    // Les lignes de remplissage sont identiques : lorsque seules ces lignes
+    // sont visibles, elles sont tires jusqu'au bord de l'cran
+    if (layer.wrapFillAbove > 0 && v0 == 0) y0 = fminf(y0, 0.f);
+    if (layer.wrapFillBelow > 0 && v1 == wrapH) y1 = fmaxf(y1, (float)m_logicalH);
 
-    SDL_Rect srcRect = { 0 };
-    srcRect.x = 0;
-    srcRect.y = textureH - 1;
-    srcRect.w = textureW;
-    srcRect.h = 1;
+    SDL_FRect dstRect = { 0 };
+    dstRect.x = originX + (float)u0 / texelsX;
+    dstRect.y = y0;
+    dstRect.w = (float)(u1 - u0) / texelsX;
+    dstRect.h = y1 - y0;
 
-    dstRect.y += 0.5f * dstRect.h;
-    dstRect.h = logicalH - dstRect.y;
+    SDL_RenderCopyF(g_renderer, layer.wrapTexture, &srcRect, &dstRect);
+}
+
+void Background::DrawLayer(const Layer &layer, SDL_Texture *texture)
+{
+    const float top = layer.y - 0.5f * m_layerH;
+    const bool onScreen = (top < (float)m_logicalH) && (top + m_layerH > 0.f);
+
+    for (int i = 0; i < layer.tileCount; i++)
+    {
+        SDL_FRect dstRect = { 0 };
+        dstRect.x = layer.x + (float)i * m_layerW;
+        dstRect.y = layer.y;
+        dstRect.w = m_layerW;
+        dstRect.h = m_layerH;
+
+        switch (layer.mode)
+        {
+        default:
+        case Background::RenderMode::NO_FILL:
+            break;
+        case Background::RenderMode::FILL_ABOVE:
+            FillLayerAbove(layer, texture, dstRect);
+            break;
+        case Background::RenderMode::FILL_BELOW:
+            FillLayerBelow(layer, texture, dstRect);
+            break;
+        case Background::RenderMode::FILL_VERTICAL:
+            FillLayerAbove(layer, texture, dstRect);
+            FillLayerBelow(layer, texture, dstRect);
+            break;
+        }
+
+        if (onScreen)
+        {
+            RenderCopyF(g_renderer, texture, NULL, &dstRect, Anchor::WEST);
+        }
+    }
+}
+
+inline void Background::FillLayerAbove(const Layer &layer, SDL_Texture *texture, SDL_FRect dstRect)
+{
+    dstRect.h = fminf(dstRect.y - 0.5f * dstRect.h, (float)m_logicalH);
+    dstRect.y = 0.f;
+
+    if (dstRect.h > 0.f)
+    {
+        SDL_RenderCopyF(g_renderer, texture, &layer.topRow, &dstRect);
+    }
+}
+
+inline void Background::FillLayerBelow(const Layer &layer, SDL_Texture *texture, SDL_FRect dstRect)
+{
+    dstRect.y = fmaxf(dstRect.y + 0.5f * dstRect.h, 0.f);
+    dstRect.h = (float)m_logicalH - dstRect.y;
 
     if (dstRect.h > 0.f)
     {
-        SDL_RenderCopyF(g_renderer, layer, &srcRect, &dstRect);
+        SDL_RenderCopyF(g_renderer, texture, &layer.bottomRow, &dstRect);
     }
 }
 
 void Background::SetPixelsPerUnit(float pixelsPerUnit)
 {
-    if (m_layers.empty() || m_layers[0] == nullptr)
+    if (m_layers.empty() || m_layers[0].textureW <= 0)
         return;
 
-    int w, h;
-    SDL_QueryTexture(m_layers[0], nullptr, nullptr, &w, &h);
-    m_worldDim.Set((float)w / pixelsPerUnit, (float)h / pixelsPerUnit);
+    const Layer &layer = m_layers[0];
+    m_worldDim.Set((float)layer.textureW / pixelsPerUnit, (float)layer.textureH / pixelsPerUnit);
 }
@@ -31,15 +31,77 @@ public:
     void AddLayer(SDL_Texture *texture, b2Vec2 shiftFactor, RenderMode mode = RenderMode::NO_FILL);
     void SetWorldCenter(b2Vec2 center);
 
+    /// @brief Active le cache de l'image du fond.
+    /// Lorsque la camra est immobile, les calques sont dessins une fois
+    /// dans une texture cible, puis cette texture est copie  chaque frame.
+    /// @param cacheEnabled boolen indiquant si le cache est utilis.
+    void SetCacheEnabled(bool cacheEnabled);
+
+    /// @brief Force le prochain dessin du cache et des textures de bouclage.
+    /// La perte des textures cibles est dtecte automatiquement
+    /// (Game_GetRenderResetCount()).
+    void InvalidateCache();
+
 private:
+    struct Layer
+    {
+        SDL_Texture *texture;
+        b2Vec2 shiftFactor;
+        RenderMode mode;
+        int textureW;
+        int textureH;
+
+        /// @brief Lignes de la texture tires pour remplir l'cran.
+        SDL_Rect topRow;
+        SDL_Rect bottomRow;
+
+        /// @brief Position de la premire tuile visible et nombre de tuiles,
+        /// calculs une fois par frame.
+        float x;
+        float y;
+        int tileCount;
+
+        /// @brief Texture de bouclage : tuiles et lignes de remplissage composes
+        ///  la rsolution de la texture du calque. Le calque est alors dessin
+        /// par une seule copie, quelle que soit la position de la camra.
+        SDL_Texture *wrapTexture;
+        bool wrapEnabled;
+        int wrapTileCount;
+        int wrapFillAbove;
+        int wrapFillBelow;
+    };
+
     b2Vec2 m_worldDim;
     b2Vec2 m_worldCenter;
-    std::vector<SDL_Texture *> m_layers;
-    std::vector<b2Vec2> m_shiftFactors;
-    std::vector<RenderMode> m_layerModes;
+    std::vector<Layer> m_layers;
 
-    void FillLayerAbove(SDL_Texture *layer, SDL_FRect dstRect);
-    void FillLayerBelow(SDL_Texture *layer, SDL_FRect dstRect);
+    int m_logicalW;
+    int m_logicalH;
+    float m_layerW;
+    float m_layerH;
+
+    bool m_cacheEnabled;
+    bool m_cacheValid;
+    SDL_Texture *m_cacheTexture;
+    int m_cacheWidth;
+    int m_cacheHeight;
+    uint64_t m_cacheKey;
+    uint64_t m_prevKey;
+    int m_stillFrameCount;
+    Uint64 m_renderResetCount;
+
+    SDL_Texture *CreateTarget(int width, int height);
+    void ReleaseCacheTexture();
+    void ReleaseWrapTextures();
+    uint64_t ComputeLayout(Camera *camera);
+    bool UpdateCacheTexture();
+    void UpdateWrapTextures();
+    bool UpdateWrapTexture(Layer &layer);
+    void DrawLayers();
+    void DrawLayer(const Layer &layer, SDL_Texture *texture);
+    void DrawWrapTexture(const Layer &layer);
+    void FillLayerAbove(const Layer &layer, SDL_Texture *texture, SDL_FRect dstRect);
+    void FillLayerBelow(const Layer &layer, SDL_Texture *texture, SDL_FRect dstRect);
 };
 
 inline void Background::SetWorldDimensions(const b2Vec2 &dimensions)
@@ -49,9 +111,8 @@ inline void Background::SetWorldDimensions(const b2Vec2 &dimensions)
 
 inline void Background::SetWorldHeight(float height)
 {
-    int w, h;
-    SDL_QueryTexture(m_layers[0], nullptr, nullptr, &w, &h);
-    m_worldDim.Set(height * (float)w / (float)h, height);
+    const Layer &layer = m_layers[0];
+    m_worldDim.Set(height * (float)layer.textureW / (float)layer.textureH, height);
 }
 
 inline b2Vec2 Background::GetWorldDimensions() const
@@ -63,3 +124,15 @@ inline void Background::SetWorldCenter(b2Vec2 center)
 {
     m_worldCenter = center;
 }
+
+inline void Background::SetCacheEnabled(bool cacheEnabled)
+{
+    m_cacheEnabled = cacheEnabled;
+    m_cacheValid = false;
+}
+
+inline void Background::InvalidateCache()
+{
+    m_cacheValid = false;
+    ReleaseWrapTextures();
+}
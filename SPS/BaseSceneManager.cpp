@@ -8,7 +8,7 @@
 #include "DebugCamera.h"
 
 BaseSceneManager::BaseSceneManager(InputManager *inputManager) :
-    SceneManager(inputManager), m_camIndex(1)
+    SceneManager(inputManager), m_camIndex(1), m_profilerOverlay(nullptr)
 {
     ApplicationInput::GetFromManager(inputManager)->SetEnabled(true);
     MouseInput::GetFromManager(inputManager)->SetEnabled(true);
@@ -19,6 +19,9 @@ BaseSceneManager::BaseSceneManager(InputManager *inputManager) :
     m_cameras[0] = nullptr;
     m_cameras[1] = new DebugCamera(scene);
     scene->SetActiveCamera(m_cameras[1]);
+
+    // Le fond des menus fait partie de l'interface mise en cache
+    scene->GetCanvas()->SetCacheLayer(LAYER_UI_BACKGROUND);
 }
 
 BaseSceneManager::~BaseSceneManager()
@@ -54,6 +57,31 @@ void BaseSceneManager::OnSceneUpdate()
     if (debugInput->infoPressed)
     {
         scene->PrintGameObjects();
+        AllocTracker::PrintReport(10);
+    }
+    if (debugInput->profilerPressed)
+    {
+        if (m_profilerOverlay == nullptr)
+        {
+            AssetManager *assets = scene->GetAssetManager();
+            m_profilerOverlay = new UIProfilerOverlay(scene, assets->GetFont(FONT_SMALL));
+        }
+        else
+        {
+            m_profilerOverlay->SetEnabled(!m_profilerOverlay->IsEnabled());
+        }
+    }
+    if (debugInput->tracePressed)
+    {
+        if (Profiler::IsTracing())
+        {
+            Profiler::StopTrace();
+        }
+        else
+        {
+            std::string path = "trace_" + std::to_string(time(nullptr)) + ".json";
+            Profiler::StartTrace(path);
+        }
     }
 
     Scene::UpdateMode mode = scene->GetUpdateMode();
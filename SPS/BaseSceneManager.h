@@ -23,4 +23,6 @@ protected:
 private:
     std::array<Camera *, 2> m_cameras;
     int m_camIndex;
+
+    UIProfilerOverlay *m_profilerOverlay;
 };
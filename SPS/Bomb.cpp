@@ -8,9 +8,11 @@
 #include "Player.h"
 
 Bomb::Bomb(Scene* scene) :
-    Damager(scene, LAYER_TERRAIN), m_used(false)
+    Damager(scene, LAYER_TERRAIN), m_used(false), m_animator(scene->GetAnimationSystem())
 {
     SetName("Bomb");
+    SetParallelFixedUpdate(true);
+    SetContactEvents(CONTACT_NONE);
 
     AssetManager* assets = scene->GetAssetManager();
     SpriteSheet* spriteSheet = assets->GetSpriteSheet(SHEET_ITEM_BOMB);
@@ -36,6 +38,13 @@ Bomb::~Bomb()
 {
 }
 
+void Bomb::Reset()
+{
+    m_used = false;
+    timeBeforeExplode = 0;
+    m_animator.PlayAnimation("Bomb");
+}
+
 void Bomb::Start()
 {
     b2World& world = m_scene->GetWorld();
@@ -93,7 +102,7 @@ void Bomb::Render()
     if (body == nullptr) return;
 
     // TODO : decommenter  pour afficher la Bomb
-    const float angle = body->GetAngle() / b2_pi * 180.f;
+    const float angle = GetInterpolatedTransform().q.GetAngle() / b2_pi * 180.f;
     SDL_Texture* texture = m_animator.GetTexture();
     if (texture)
     {
@@ -108,15 +117,14 @@ void Bomb::Render()
     }
 }
 
-void Bomb::FixedUpdate()
+void Bomb::ParallelFixedUpdate(FixedUpdateContext &context)
 {
-    m_animator.Update(m_scene->GetDelta());
     if (timeBeforeExplode > 0)
         timeBeforeExplode--;
     else
     {
-        Explode();
-        
+        // L'explosion touche les autres objets de la scne
+        context.Defer([this]() { Explode(); });
     }
 
 }
@@ -15,11 +15,14 @@ class Bomb : public Damager
 {
 public:
     Bomb(Scene* scene);
+
+    /// @brief Rinitialise l'objet lorsqu'il est recycl par son pool.
+    void Reset();
     virtual ~Bomb();
 
     virtual void Start() override;
     virtual void Render() override;
-    virtual void FixedUpdate() override;
+    virtual void ParallelFixedUpdate(FixedUpdateContext &context) override;
 
     virtual bool TakeDamage(const Damage& damage, Damager* damager);
     float timeBeforeExplode;
@@ -10,7 +10,8 @@
 DebugInput::DebugInput() :
     InputGroup(), nextStepDown(false), nextStepPressed(false), quitStepPressed(false),
     infoPressed(false), gizmosPressed(false), bodyPressed(false),
-    camPressed(false), gridPressed(false)
+    camPressed(false), gridPressed(false), profilerPressed(false),
+    tracePressed(false)
 {
 }
 
@@ -23,6 +24,8 @@ void DebugInput::OnPreEventProcess()
     quitStepPressed = false;
     nextStepPressed = false;
     gridPressed = false;
+    profilerPressed = false;
+    tracePressed = false;
 }
 
 void DebugInput::OnEventProcess(SDL_Event evt)
@@ -74,6 +77,16 @@ void DebugInput::OnEventProcess(SDL_Event evt)
             infoPressed = true;
             break;
 
+        case SDL_SCANCODE_F8:
+            // Profileur
+            profilerPressed = true;
+            break;
+
+        case SDL_SCANCODE_F9:
+            // Export de la trace du profileur
+            tracePressed = true;
+            break;
+
         default:
             break;
         }
@@ -110,6 +123,8 @@ void DebugInput::Reset()
     nextStepPressed = false;
     quitStepPressed = false;
     gridPressed = false;
+    profilerPressed = false;
+    tracePressed = false;
 }
 
 DebugInput *DebugInput::GetFromManager(InputManager *inputManager)
@@ -31,5 +31,9 @@ public:
     // Changement de camra
     bool camPressed;
 
+    // Profileur
+    bool profilerPressed;
+    bool tracePressed;
+
     static DebugInput *GetFromManager(InputManager *inputManager);
 };
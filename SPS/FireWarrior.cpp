@@ -190,7 +190,9 @@ void FireWarrior::Start()
     fixtureDef.friction = 0.f;
     fixtureDef.restitution = 0.f;
     fixtureDef.filter.categoryBits = m_config->teamMask;
-    fixtureDef.filter.maskBits = m_config->otherTeamMask | CATEGORY_PROJECTILE;
+    // Les attaques trouvent ce corps par des requêtes, qui ignorent le masque.
+    // Les contacts entre joueurs étaient désactivés par OnCollisionStay()
+    fixtureDef.filter.maskBits = CATEGORY_PROJECTILE;
 
     m_bodyFixture = CreateFixture(&fixtureDef);
 
@@ -310,7 +312,7 @@ void FireWarrior::OnAnimationEnd(Animation *which, const std::string &name)
     
     if (name == "Roll")
     {
-        m_delayLockRoll = 1;
+        SetDelay(m_delayLockRoll, 1);
         SetState(Player::State::IDLE);
 
     }
@@ -340,7 +342,7 @@ void FireWarrior::OnAnimationEnd(Animation *which, const std::string &name)
         {
             m_animator.PlayAnimation("SmashHold");
             m_countSmash+= 0.05f;
-            m_delayLock = 1;
+            SetDelay(m_delayLock, 1);
             m_delayAnimation++;
             if((m_delayAnimation % 5)  == 2)
             SmashParticle();
@@ -348,7 +350,7 @@ void FireWarrior::OnAnimationEnd(Animation *which, const std::string &name)
         else
         {
             m_animator.PlayAnimation("SmashRelease");
-            m_delayLock = 1;
+            SetDelay(m_delayLock, 1);
         }
     }
     else if (name == "SmashRelease")
@@ -357,7 +359,7 @@ void FireWarrior::OnAnimationEnd(Animation *which, const std::string &name)
         SetState(Player::State::IDLE); 
         LockAttack(0.5f); 
         m_countSmash = 1;
-        m_delayLock = 0.5;
+        SetDelay(m_delayLock, 0.5);
 
     }
     /*else if (name == "Special")
@@ -369,16 +371,16 @@ void FireWarrior::OnAnimationEnd(Animation *which, const std::string &name)
     }*/
     else if (name == "Defend")
     {
-        if (m_delayDefend > 0)
+        if (GetDelay(m_delayDefend) > 0)
         {
             m_animator.PlayAnimation("Defend");
             //m_shieldAnimator.PlayAnimation("Shield");
         }
         SetState(Player::State::IDLE);
         LockAttack(0.25f);
-        m_delayLock = 0.25f;
-        if (m_delayDefend <= 0)
-            m_delayLockDefend = 5.f;
+        SetDelay(m_delayLock, 0.25f);
+        if (GetDelay(m_delayDefend) <= 0)
+            SetDelay(m_delayLockDefend, 5.f);
     }
 
 }
@@ -8,9 +8,10 @@
 #include "Player.h"
 
 JumpPotion::JumpPotion(Scene* scene) :
-    Damager(scene, LAYER_TERRAIN), m_used(false)
+    Damager(scene, LAYER_TERRAIN), m_used(false), m_animator(scene->GetAnimationSystem())
 {
     SetName("JumpPotion");
+    SetContactEvents(CONTACT_NONE);
 
     AssetManager* assets = scene->GetAssetManager();
     SpriteSheet* spriteSheet = assets->GetSpriteSheet(SHEET_ITEM_JUMPPOTION);
@@ -32,6 +33,12 @@ JumpPotion::~JumpPotion()
 {
 }
 
+void JumpPotion::Reset()
+{
+    m_used = false;
+    m_animator.PlayAnimation("JumpPotion");
+}
+
 void JumpPotion::Start()
 {
     b2World& world = m_scene->GetWorld();
@@ -87,7 +94,7 @@ void JumpPotion::Render()
     if (body == nullptr) return;
 
     // TODO : decommenter  pour afficher la potion
-    const float angle = body->GetAngle() / b2_pi * 180.f;
+    const float angle = GetInterpolatedTransform().q.GetAngle() / b2_pi * 180.f;
     SDL_Texture* texture = m_animator.GetTexture();
     if (texture)
     {
@@ -102,11 +109,6 @@ void JumpPotion::Render()
     }
 }
 
-void JumpPotion::FixedUpdate()
-{
-    m_animator.Update(m_scene->GetDelta());
-}
-
 bool JumpPotion::TakeDamage(const Damage& damage, Damager* damager)
 {
     if (m_used) return false;
@@ -15,11 +15,13 @@ class JumpPotion : public Damager
 {
 public:
     JumpPotion(Scene* scene);
+
+    /// @brief Rinitialise l'objet lorsqu'il est recycl par son pool.
+    void Reset();
     virtual ~JumpPotion();
 
     virtual void Start() override;
     virtual void Render() override;
-    virtual void FixedUpdate() override;
 
     virtual bool TakeDamage(const Damage& damage, Damager* damager);
 
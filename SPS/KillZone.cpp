@@ -0,0 +1,47 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "KillZone.h"
+#include "Player.h"
+
+KillZone::KillZone(Scene *scene, const b2AABB &bounds) :
+    GameBody(scene, LAYER_TERRAIN), m_bounds(bounds)
+{
+    SetName("KillZone");
+}
+
+KillZone::~KillZone()
+{
+}
+
+void KillZone::Start()
+{
+    // L'objet n'a pas de corps : ses volumes sont fixes dans le monde
+    TriggerSystem &triggers = m_scene->GetTriggerSystem();
+    const b2Vec2 lower = m_bounds.lowerBound;
+    const b2Vec2 upper = m_bounds.upperBound;
+    const b2Vec2 center = m_bounds.GetCenter();
+    const b2Vec2 extents = m_bounds.GetExtents();
+    const float depth = 0.5f * KILL_ZONE_DEPTH;
+
+    // Les zones horizontales couvrent aussi les coins
+    b2Vec2 hExtents(extents.x + KILL_ZONE_DEPTH, depth);
+    b2Vec2 vExtents(depth, extents.y);
+
+    triggers.AddAABB(this, b2Vec2(center.x, lower.y - depth), hExtents, CATEGORY_ALL_TEAMS);
+    triggers.AddAABB(this, b2Vec2(center.x, upper.y + depth), hExtents, CATEGORY_ALL_TEAMS);
+    triggers.AddAABB(this, b2Vec2(lower.x - depth, center.y), vExtents, CATEGORY_ALL_TEAMS);
+    triggers.AddAABB(this, b2Vec2(upper.x + depth, center.y), vExtents, CATEGORY_ALL_TEAMS);
+}
+
+void KillZone::OnTriggerEnter(const TriggerEvent &event)
+{
+    Player *player = dynamic_cast<Player *>(event.actor);
+    if (player)
+    {
+        player->OnPlayerKO();
+    }
+}
@@ -0,0 +1,31 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "GameSettings.h"
+#include "GameCommon.h"
+
+/// @brief Epaisseur des zones qui entourent le niveau.
+#define KILL_ZONE_DEPTH 100.f
+
+/// @brief Zones hors du niveau dans lesquelles un joueur est mis KO.
+/// Les quatre zones bordent les limites du niveau et sont testes par le
+/// TriggerSystem de la scne : elles ne crent aucun contact Box2D.
+class KillZone : public GameBody
+{
+public:
+    /// @brief Cre les zones autour d'une rgion du monde.
+    /// @param bounds les limites en dehors desquelles un joueur est mis KO.
+    KillZone(Scene *scene, const b2AABB &bounds);
+    virtual ~KillZone();
+
+    virtual void Start() override;
+    virtual void OnTriggerEnter(const TriggerEvent &event) override;
+
+protected:
+    b2AABB m_bounds;
+};
@@ -167,7 +167,9 @@ void LightningWarrior::Start()
     fixtureDef.friction = 0.f;
     fixtureDef.restitution = 0.f;
     fixtureDef.filter.categoryBits = m_config->teamMask;
-    fixtureDef.filter.maskBits = m_config->otherTeamMask | CATEGORY_PROJECTILE;
+    // Les attaques trouvent ce corps par des requêtes, qui ignorent le masque.
+    // Les contacts entre joueurs étaient désactivés par OnCollisionStay()
+    fixtureDef.filter.maskBits = CATEGORY_PROJECTILE;
 
     m_bodyFixture = CreateFixture(&fixtureDef);
 
@@ -274,7 +276,7 @@ void LightningWarrior::OnAnimationEnd(Animation *which, const std::string &name)
 
     if (name == "Slide")
     {
-        m_delayLockRoll = 1;
+        SetDelay(m_delayLockRoll, 1);
         SetState(Player::State::IDLE);
 
     }
@@ -304,7 +306,7 @@ void LightningWarrior::OnAnimationEnd(Animation *which, const std::string &name)
         {
             m_animator.PlayAnimation("SmashHold");
             m_countSmash += 0.05f;
-            m_delayLock = 1;
+            SetDelay(m_delayLock, 1);
             m_delayAnimationLight++;
             if (m_delayAnimationLight % 36 == 2)
                 SmashParticleLight();
@@ -312,7 +314,7 @@ void LightningWarrior::OnAnimationEnd(Animation *which, const std::string &name)
         else
         {
             m_animator.PlayAnimation("SmashRelease");
-            m_delayLock = 1;
+            SetDelay(m_delayLock, 1);
         }
     }
     else if (name == "SmashRelease")
@@ -321,12 +323,12 @@ void LightningWarrior::OnAnimationEnd(Animation *which, const std::string &name)
         SetState(Player::State::IDLE);
         LockAttack(0.5f);
         m_countSmash = 1;
-        m_delayLock = 0.5;
+        SetDelay(m_delayLock, 0.5);
         m_delayAnimationLight = 1;
     }
     else if (name == "Defend")
     {
-        if (m_delayDefend > 0)
+        if (GetDelay(m_delayDefend) > 0)
         {
             m_animator.PlayAnimation("Defend");
         }
@@ -8,6 +8,7 @@
 #include "GameCommon.h"
 
 #include "StageManager.h"
+#include "StressManager.h"
 #include "TitleManager.h"
 
 #if 0
@@ -53,6 +54,24 @@ int main(int argc, char *argv[])
 
     srand((unsigned int)time(nullptr));
 
+    // Options de la ligne de commande
+    StressConfig stressConfig;
+    stressConfig.ParseArgs(argc, argv);
+
+    for (int i = 1; i < argc; i++)
+    {
+        // --trace <fichier> : exporte la trace du profileur
+        if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            Profiler::StartTrace(argv[++i]);
+        }
+        // --hot-reload : recharge les feuilles de sprites modifiées
+        else if (strcmp(argv[i], "--hot-reload") == 0)
+        {
+            AssetManager::SetHotReloadEnabled(true);
+        }
+    }
+
     // Crée la fenêtre
     Uint32 windowFlags = 0;
 #ifdef FULLSCREEN
@@ -70,9 +89,13 @@ int main(int argc, char *argv[])
     }
 
     // Crée le moteur de rendu
-    g_renderer = SDL_CreateRenderer(
-        g_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
-    );
+    // Les tests de charge mesurent les frames sans synchronisation verticale
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+    if (stressConfig.enabled == false)
+    {
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    g_renderer = SDL_CreateRenderer(g_window, -1, rendererFlags);
     if (!g_renderer)
     {
         printf("ERROR - Create renderer %s\n", SDL_GetError());
@@ -137,20 +160,38 @@ int main(int argc, char *argv[])
     state = GameState::STAGE;
 #endif
 
+    if (stressConfig.enabled)
+    {
+        stressConfig.ApplyTo(configs, stageConfig);
+        state = GameState::STAGE;
+    }
+
     // Boucle de jeu
     while (quitGame == false)
     {
         // Construction de la scène
-        switch (state)
+        PROFILE_MARKER("SceneTransition::Load", (int)state);
         {
-        case GameState::STAGE:
-            sceneManger = new StageManager(inputManager, configs, stageConfig);
-            break;
+            PROFILE_SCOPE("SceneTransition::Load");
+            switch (state)
+            {
+            case GameState::STAGE:
+                if (stressConfig.enabled)
+                {
+                    sceneManger = new StressManager(
+                        inputManager, configs, stageConfig, stressConfig);
+                }
+                else
+                {
+                    sceneManger = new StageManager(inputManager, configs, stageConfig);
+                }
+                break;
 
-        case GameState::MAIN_MENU:
-        default:
-            sceneManger = new TitleManager(inputManager, configs, stageConfig, playerCount);
-            break;
+            case GameState::MAIN_MENU:
+            default:
+                sceneManger = new TitleManager(inputManager, configs, stageConfig, playerCount);
+                break;
+            }
         }
 
         // Boucle de rendu
@@ -199,11 +240,13 @@ int main(int argc, char *argv[])
 
         if (sceneManger)
         {
+            PROFILE_SCOPE("SceneTransition::Unload");
             delete sceneManger;
             sceneManger = nullptr;
         }
     }
 
+    Profiler::StopTrace();
 
     delete inputManager; inputManager = nullptr;
     SDL_DestroyRenderer(g_renderer); g_renderer = nullptr;
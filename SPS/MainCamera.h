@@ -19,6 +19,8 @@ public:
     virtual void DrawGizmos(Gizmos &gizmos) override;
     virtual void Shake(int intensity) override;
 
+    void SetWidthRange(float minWidth, float maxWidth);
+
 protected:
     b2Vec2 m_center;
     b2Vec2 m_target;
@@ -30,3 +32,9 @@ protected:
 
     void UpdatePlayersBox();
 };
+
+inline void MainCamera::SetWidthRange(float minWidth, float maxWidth)
+{
+    m_minWidth = minWidth;
+    m_maxWidth = maxWidth;
+}
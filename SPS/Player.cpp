@@ -5,8 +5,7 @@
 */
 
 #include "Player.h"
-#include "PlatformG.h"
-#include "PlatformD.h"
+#include "StageTerrain.h"
 #include "PlayerAI.h"
 #include "StageManager.h"
 
@@ -17,21 +16,24 @@ const float ATTACK_FRAME_TIME = 0.04f;
 Player::Player(Scene* scene, const PlayerConfig* config, PlayerStats* stats) :
     Damager(scene, Layer::LAYER_PLAYER), m_config(config), m_stats(stats),
     m_facingRight(true), m_hDirection(0.f),
-    m_state(State::IDLE), m_animator(),
-    m_shieldAnimator(), m_ejectionScore(0.f), m_defend(false), m_launchBegins(false),
+    m_state(State::IDLE), m_animator(scene->GetAnimationSystem(AnimClock::FIXED)),
+    m_shieldAnimator(scene->GetAnimationSystem(AnimClock::FIXED)), m_ejectionScore(0.f), m_defend(false), m_launchBegins(false),
     m_ejection(b2Vec2_zero), m_hVelocity(0.f),
     m_jumpImpulse(18.f), m_ai(nullptr),
     m_attackType(AttackType::NONE),
-    m_delayAttack(-1.f), m_delaySmash(-1.f),  m_delayEarlyJump(-1.f), m_countJump(-1), //m_delaySpecial(-1.f),
-    m_delayLock(-1.f), m_delayLockAttack(-1.f), m_delayDefend(-1.f), m_delayLockDefend(-1.f),
+    m_delayAttack(), m_delaySmash(),  m_delayEarlyJump(-1.f), m_countJump(-1), //m_delaySpecial(-1.f),
+    m_delayLock(), m_delayLockAttack(), m_delayDefend(), m_delayLockDefend(),
     m_autoVelocity(0.f), m_hasAutoVelocity(false), m_externalVelocity(b2Vec2_zero),
     m_isGrounded(true), m_wasGrounded(true), m_inContact(false),
     m_bodyFixture(nullptr), m_feetFixture(nullptr), m_lastDamager(nullptr),
-    m_renderShift(b2Vec2_zero), m_delayRoll(), m_delayLockRoll(1), m_delayJumpPotionleft(-1), m_hasToucjedFloor(-1)
+    m_renderShift(b2Vec2_zero), m_delayRoll(), m_delayLockRoll(), m_delayJumpPotionleft(), m_hasToucjedFloor(-1)
 {
     SetName("Player");
     SetStartPosition(0.f, 3.f);
 
+    // Seul OnCollisionStay() est utilisé par le joueur
+    SetContactEvents(CONTACT_STAY);
+
     AssetManager *assets = scene->GetAssetManager();
     SpriteSheet *spriteSheet = nullptr;
     SpriteGroup *spriteGroup = nullptr;
@@ -50,21 +52,10 @@ Player::Player(Scene* scene, const PlayerConfig* config, PlayerStats* stats) :
 
 
 
-    AddFixedUpdateDelay(&m_delayLock);
-    AddFixedUpdateDelay(&m_delayAttack);
-    AddFixedUpdateDelay(&m_delayLockAttack);
-    AddFixedUpdateDelay(&m_delayLockRoll);
-    AddFixedUpdateDelay(&m_delayRoll);
-    AddFixedUpdateDelay(&m_delaySmash);
-    //AddFixedUpdateDelay(&m_delaySpecial);
-    AddFixedUpdateDelay(&m_delayLockFarAttack);
-    AddFixedUpdateDelay(&m_askedFarAttack);
-    AddFixedUpdateDelay(&m_delayJumpPotionleft);
-    AddFixedUpdateDelay(&m_delayDefend);
-    AddFixedUpdateDelay(&m_delayLockDefend);
-    
+    // La roulade est bloquée pendant la première seconde
+    SetDelay(m_delayLockRoll, 1.f);
 
-    if (m_delayLock >0)
+    if (GetDelay(m_delayLock) >0)
     {
         return;
     }
@@ -72,12 +63,18 @@ Player::Player(Scene* scene, const PlayerConfig* config, PlayerStats* stats) :
     // IA
     if (config->isCPU)
     {
+        // Les IA réfléchissent en parallèle avant les FixedUpdate()
         m_ai = new PlayerAI(this);
+        SetParallelFixedUpdate(true);
     }
 
     m_animator.AddListener(this);
     m_shieldAnimator.AddListener(this);
 
+    // Les animations rythment les attaques, elles avancent avec les pas fixes
+    m_animator.SetClock(AnimClock::FIXED);
+    m_shieldAnimator.SetClock(AnimClock::FIXED);
+
     // ID
     SetPlayerID(config->playerID);
 
@@ -94,9 +91,22 @@ Player::~Player()
     if (m_ai) delete m_ai;
 }
 
+void Player::SetDelay(TimerHandle &delay, float time)
+{
+    TimerWheel &timers = m_scene->GetFixedTimers();
+    timers.Cancel(delay);
+    if (time > 0.f)
+    {
+        delay = timers.Schedule(time);
+    }
+}
+
 void Player::Start()
 {
     SetState(State::IDLE);
+
+    // Le joueur est détecté par les volumes de déclenchement de la scène
+    m_scene->GetTriggerSystem().AddActor(this, m_config->teamMask);
 }
 
 void Player::SetState(Player::State state)
@@ -128,11 +138,11 @@ void Player::Update()
     else  if (input.attackPressed)
     {
         m_attackType = AttackType::COMBO ;
-        m_delayAttack = 0.5;
+        SetDelay(m_delayAttack, 0.5);
     }
     else if (input.goDownDown)
     {
-        m_delayRoll = 0.5f;
+        SetDelay(m_delayRoll, 0.5f);
     }
 
     //else  if (input.smashDown)
@@ -144,29 +154,29 @@ void Player::Update()
     else  if (input.smashPressed)
     {
         m_attackType = AttackType::SMASH; 
-        m_delaySmash = 0.5;
+        SetDelay(m_delaySmash, 0.5);
     }
 
     else if (input.specialDown)
     {
-        m_askedFarAttack = 0.5;
+        SetDelay(m_askedFarAttack, 0.5);
         printf("in here c down\n");
     }
-    if (input.defendPressed && m_delayDefend <= 0)
+    if (input.defendPressed && GetDelay(m_delayDefend) <= 0)
     {
-        m_delayDefend = 0.8f;        
-        //printf("input : %f", m_delayDefend);
+        SetDelay(m_delayDefend, 0.8f);        
+        //printf("input : %f", GetDelay(m_delayDefend));
 
     }
     /*if (input.defendDown)
     {
-        m_delayDefend = 0.8f;
-        printf("input bis : %f", m_delayDefend);
+        SetDelay(m_delayDefend, 0.8f);
+        printf("input bis : %f", GetDelay(m_delayDefend));
 
     }*/
 
     GetDownJumpCount(0);
-    //printf("time left %f \n", m_delayJumpPotionleft);
+    //printf("time left %f \n", GetDelay(m_delayJumpPotionleft));
 
 
     // TODO : membre m_defend à modifier
@@ -212,7 +222,7 @@ void Player::Render()
         g_renderer, texture, src, &rect,
         Anchor::NORTH, 0.f, b2Vec2(0.f, 0.f), flip);
 
-    //printf("render : %d %f\n", GetPlayerID(), m_delayDefend);
+    //printf("render : %d %f\n", GetPlayerID(), GetDelay(m_delayDefend));
     
 }
 
@@ -222,24 +232,14 @@ void Player::FixedUpdate()
 
     if (m_ai)
     {
-        m_ai->FixedUpdate();
         Update();
     }
-    //printf("FU : %d %f\n", GetPlayerID(), m_delayDefend);
+    //printf("FU : %d %f\n", GetPlayerID(), GetDelay(m_delayDefend));
 
     b2Body *body = GetBody();
     b2Vec2 position = body->GetPosition();
     b2Vec2 velocity = GetVelocity();
 
-    m_animator.Update(m_scene->GetTime().GetDelta());
-    m_shieldAnimator.Update(m_scene->GetTime().GetDelta());
-
-    if (position.y < -5.f || fabsf(position.x) > 40.f || position.y > 25.f )
-    {
-        OnPlayerKO();
-        return;
-    }
-
     // Détection du sol
     FixedUpdateIsGrounded();
 
@@ -253,14 +253,14 @@ void Player::FixedUpdate()
     FixedUpdateState();
     FixedUpdateAutoVelocity();
 
-    if (m_delayLock > 0.f)
+    if (GetDelay(m_delayLock) > 0.f)
         return;
     
 
    
 
     // Calcule l'orientation
-    if ((IsAttacking() == false) && m_delayLock < 0.f)
+    if ((IsAttacking() == false) && GetDelay(m_delayLock) < 0.f)
     {
         if ((m_hDirection > 0.f && !m_facingRight) ||
             (m_hDirection < 0.f && m_facingRight))
@@ -352,7 +352,7 @@ void Player::FixedUpdateState()
 
     // TODO : état DEFEND
  
-    if (m_askedFarAttack > 0 && m_delayLockFarAttack <0)
+    if (GetDelay(m_askedFarAttack) > 0 && GetDelay(m_delayLockFarAttack) <0)
     {
         SetState(State::FAR_ATTACK); 
         //printf("on y go\n");
@@ -368,19 +368,19 @@ void Player::FixedUpdateState()
     // Etat au sol
     if (m_isGrounded)
     {
-        //printf("icxiiiiiii %f\n", m_delayDefend);
+        //printf("icxiiiiiii %f\n", GetDelay(m_delayDefend));
         m_countJump = 0;
         m_hasToucjedFloor =0;
-       // printf("delay roll %f et delay lock %f\n", m_delayRoll, m_delayLockRoll);
+       // printf("delay roll %f et delay lock %f\n", GetDelay(m_delayRoll), GetDelay(m_delayLockRoll));
         // TODO : modifier
         if (IsAttacking() == false)
         {
-            if (CanAttack() &&  m_delayAttack >0)
+            if (CanAttack() &&  GetDelay(m_delayAttack) >0)
             {
                 SetState(State::ATTACK);
                 
             }
-            else if (CanAttack() && m_delaySmash > 0)
+            else if (CanAttack() && GetDelay(m_delaySmash) > 0)
             {
                 SetState(State::SMASH_START);
                 /*if (input.smashDown)
@@ -390,11 +390,11 @@ void Player::FixedUpdateState()
 
             }
             
-            else if (m_delayDefend > 0 && m_delayLockDefend <= 0)
+            else if (GetDelay(m_delayDefend) > 0 && GetDelay(m_delayLockDefend) <= 0)
             {
                 //printf("lets goooooooo");
                 SetState(State::DEFEND);
-                //m_delayLockDefend = 5;
+                //SetDelay(m_delayLockDefend, 5);
                 //m_shieldAnimator.PlayAnimation("Shield");
             }
            /* else if (CanAttack() && m_delaySpecial > 0)
@@ -406,7 +406,7 @@ void Player::FixedUpdateState()
             {
                 if (velocity.x != 0)
                     SetState(State::RUN);            
-                else if (m_delayRoll >0 && m_delayLockRoll <0 && position.y < 3)
+                else if (GetDelay(m_delayRoll) >0 && GetDelay(m_delayLockRoll) <0 && position.y < 3)
                     SetState(State::ROLLING);               
                 else if (m_delayEarlyJump)
                      SetState(State::JUMP);
@@ -422,7 +422,7 @@ void Player::FixedUpdateState()
     {   
         if (IsAttacking() == false)     
         {
-            if (CanAttack() && m_delayAttack > 0) 
+            if (CanAttack() && GetDelay(m_delayAttack) > 0) 
             {
                 SetState(State::ATTACK_AIR);
 
@@ -436,9 +436,9 @@ void Player::FixedUpdateState()
             {
                 SetState(State::FALL);
             }
-           /* if (m_delayDefend > 0)
+           /* if (GetDelay(m_delayDefend) > 0)
             {
-                printf("laaa %f\n", m_delayDefend);
+                printf("laaa %f\n", GetDelay(m_delayDefend));
                 SetState(State::DEFEND);
                 m_shieldAnimator.PlayAnimation("Shield");
             }*/
@@ -559,6 +559,11 @@ void Player::FixedUpdatePhysics()
     m_externalVelocity.SetZero();
 }
 
+void Player::ParallelFixedUpdate(FixedUpdateContext &context)
+{
+    if (m_ai) m_ai->ParallelFixedUpdate(context);
+}
+
 void Player::OnCollisionStay(GameCollision &collision)
 {
     if (collision.fixture == m_bodyFixture)
@@ -567,7 +572,8 @@ void Player::OnCollisionStay(GameCollision &collision)
         return;
     }
 
-    float sep = b2Min(collision.manifold.separations[0], collision.manifold.separations[1]);
+    const b2WorldManifold &manifold = collision.GetManifold();
+    float sep = b2Min(manifold.separations[0], manifold.separations[1]);
     if (sep < -0.1f)
     {
         collision.SetEnabled(false);
@@ -576,40 +582,29 @@ void Player::OnCollisionStay(GameCollision &collision)
     Terrain *terrain = dynamic_cast<Terrain *>(collision.gameBody);
     if (terrain && terrain->IsOneWay())
     {
-        if (m_delayRoll > 0.4)
+        if (GetDelay(m_delayRoll) > 0.4)
         {
             collision.SetEnabled(false);
         }
-        else if (m_delayRoll < 0)
+        else if (GetDelay(m_delayRoll) < 0)
         {
             collision.SetEnabled(true);
 
         }
 
-        if (Math::AngleDeg(collision.manifold.normal, b2Vec2(0, 1)) < 110.f)
+        if (Math::AngleDeg(manifold.normal, b2Vec2(0, 1)) < 110.f)
         {
             collision.SetEnabled(false);
         }
 
-        if (collision.manifold.normal.y > -0.1f)
+        if (manifold.normal.y > -0.1f)
             collision.SetEnabled(false);
     }
 
     if (collision.IsEnabled())
     {
-        PlatformG *platformG = dynamic_cast<PlatformG *>(collision.gameBody);
-        {
-            if (platformG) platformG->AddGameBody(this);
-        }
-
-        m_inContact = true;
-    }
-    if (collision.IsEnabled())
-    {
-        PlatformD* platformD = dynamic_cast<PlatformD*>(collision.gameBody);
-        {
-            if (platformD) platformD->AddGameBody(this);
-        }
+        StageTerrain *stageTerrain = dynamic_cast<StageTerrain *>(collision.gameBody);
+        if (stageTerrain) stageTerrain->AddGameBody(this);
 
         m_inContact = true;
     }
@@ -753,10 +748,10 @@ void Player::OnPlayerKO()
     m_ejectionScore = 0.f;
 
     // TODO : Décommenter une fois les délais utilisés
-    m_delayAttack = -1.f;
+    SetDelay(m_delayAttack, -1.f);
     m_delayEarlyJump = -1.f;
-    m_delayLock = -1.f;
-    m_delayLockAttack = -1.f;
+    SetDelay(m_delayLock, -1.f);
+    SetDelay(m_delayLockAttack, -1.f);
 
     m_stats->fallCount++;
 
@@ -773,7 +768,7 @@ void Player::Respawn()
 
 void Player::LockAttack(float lockTime)
 {
-    m_delayLockAttack = b2Max(m_delayLockAttack, lockTime);
+    SetDelay(m_delayLockAttack, b2Max(GetDelay(m_delayLockAttack), lockTime));
 }
 
 
@@ -786,7 +781,7 @@ void Player::OnStateChanged(Player::State state, Player::State prevState)
 
     switch (state)
     {
-    case State::ATTACK: m_delayAttack = -1.f;
+    case State::ATTACK: SetDelay(m_delayAttack, -1.f);
 
     // TODO : en DEFEND, animation
     default:
@@ -820,8 +815,8 @@ bool Player::TakeDamage(const Damage &damage, Damager *damager)
         return false;
     }
     m_lastDamager = damager;
-    m_delayLockAttack = b2Max(m_delayLockAttack, damage.lockAttackTime);
-    m_delayLock = damage.lockTime;
+    SetDelay(m_delayLockAttack, b2Max(GetDelay(m_delayLockAttack), damage.lockAttackTime));
+    SetDelay(m_delayLock, damage.lockTime);
     m_stats->damageTaken += damage.amount;
     m_ejectionScore += damage.amount;
     
@@ -906,7 +901,7 @@ void Player::OnAnimationEnd(Animation* which, const std::string& name)
     if (name == "Shield") {                         //lent
         m_shieldAnimator.StopAnimation();
         printf("stopppp");
-        m_delayLockDefend = 5.f;
+        SetDelay(m_delayLockDefend, 5.f);
 
     }
     if (name == "Defend") {                         //rapide
@@ -943,14 +938,14 @@ void Player::OnAnimationEnd(Animation* which, const std::string& name)
 
 void Player::GetDownJumpCount(int check)
 {
-    //printf("mDealy JumpBoost : %f \n", m_delayJumpPotionleft);
+    //printf("mDealy JumpBoost : %f \n", GetDelay(m_delayJumpPotionleft));
     if (check == 1) {
-        m_delayJumpPotionleft = 10 ;
+        SetDelay(m_delayJumpPotionleft, 10 );
         check = 0;
        // PlayPotionTimeAinmation();
         
     }
-    if ((m_delayJumpPotionleft > 1 && m_countJump == 2))
+    if ((GetDelay(m_delayJumpPotionleft) > 1 && m_countJump == 2))
     {
       if (m_hasToucjedFloor == 0)
       {
@@ -32,10 +32,15 @@ public:
     };
 
     virtual void OnCollisionStay(GameCollision &collision) override;
+    virtual void ParallelFixedUpdate(FixedUpdateContext &context) override;
     virtual bool TakeDamage(const Damage &damage, Damager *damager) override;
 
     virtual void OnStateChanged(Player::State state, Player::State prevState);
     void Heal(float amount); // TODO : decommenter
+
+    /// @brief Met le joueur KO et le fait rapparatre.
+    /// Appele par la KillZone du niveau lorsque le joueur en sort.
+    void OnPlayerKO();
     void GetDownJumpCount(int ckeck);
 
 
@@ -62,7 +67,7 @@ public:
 
     virtual void OnAnimationEnd(Animation* which, const std::string& name) override;
     float m_countJump;
-    float m_delayJumpPotionleft;
+    TimerHandle m_delayJumpPotionleft;
 
     
 
@@ -87,19 +92,28 @@ protected:
     Animator m_shieldAnimator;
     Damager *m_lastDamager;
 
+    /// @brief Renvoie le temps restant d'un dlai (en secondes), ou -1 s'il a expir.
+    /// Les dlais sont des minuteries des pas fixes (Scene::GetFixedTimers()).
+    float GetDelay(const TimerHandle &delay) const;
+
+    /// @brief Reprogramme un dlai.
+    /// @param delay le dlai  modifier.
+    /// @param time la nouvelle dure (en secondes), le dlai est annul si elle est nulle ou ngative.
+    void SetDelay(TimerHandle &delay, float time);
+
     float m_delayEarlyJump;
-    float m_delayAttack;
-    float m_delaySmash;
+    TimerHandle m_delayAttack;
+    TimerHandle m_delaySmash;
     float m_delaySpecial;
-    float m_delayLock;
-    float m_delayLockAttack;
-    float m_delayRoll;
-    float m_delayLockRoll;
-    float m_delayLockFarAttack;
-    float m_askedFarAttack;
+    TimerHandle m_delayLock;
+    TimerHandle m_delayLockAttack;
+    TimerHandle m_delayRoll;
+    TimerHandle m_delayLockRoll;
+    TimerHandle m_delayLockFarAttack;
+    TimerHandle m_askedFarAttack;
     float m_hasToucjedFloor;
-    float m_delayDefend;
-    float m_delayLockDefend;
+    TimerHandle m_delayDefend;
+    TimerHandle m_delayLockDefend;
 
     float m_ejectionScore;
     float m_hDirection;
@@ -143,7 +157,6 @@ protected:
 
     const PlayerInput &GetPlayerInput() const;
 
-    void OnPlayerKO();
     void Respawn();
     void LockAttack(float lockTime);
     bool IsAttacking() const;
@@ -170,7 +183,12 @@ inline bool Player::IsAttacking() const
 
 inline bool Player::CanAttack() const
 {
-    return m_delayLockAttack < 0.f;
+    return GetDelay(m_delayLockAttack) < 0.f;
+}
+
+inline float Player::GetDelay(const TimerHandle &delay) const
+{
+    return m_scene->GetFixedTimers().GetRemaining(delay);
 }
 
 inline const PlayerConfig *Player::GetConfig() const
@@ -218,7 +236,7 @@ inline void Player::AddTotalAttack()
 
 inline float Player::GetTimeLeftJumpPotion()
 {
-    return m_delayJumpPotionleft;
+    return GetDelay(m_delayJumpPotionleft);
 }
 
 inline Color Player::getDamageColor()
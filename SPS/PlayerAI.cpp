@@ -9,7 +9,7 @@
 
 
 PlayerAI::PlayerAI(Player *player) :
-    m_player(player), m_input(), m_target(nullptr), m_delayBeforeCheck(0)
+    m_player(player), m_input(), m_target(nullptr), m_checkTimer(), m_checkPending(false)
 {
     m_scene = m_player->m_scene;
     m_player->m_maxSpeed = 6.f;
@@ -20,9 +20,10 @@ PlayerAI::PlayerAI(Player *player) :
 
 PlayerAI::~PlayerAI()
 {
+    m_scene->GetFixedTimers().Cancel(m_checkTimer);
 }
 
-void PlayerAI::FixedUpdate()
+void PlayerAI::ParallelFixedUpdate(FixedUpdateContext &context)
 {
     b2Body *body = m_player->GetBody();
     b2Vec2 position = m_player->GetPosition();
@@ -38,8 +39,7 @@ void PlayerAI::FixedUpdate()
 
     
 
-    m_player->AddFixedUpdateDelay(&m_delayBeforeCheck); 
-    if (m_delayBeforeCheck > 0)
+    if (m_checkPending)
         return;
 
     
@@ -57,8 +57,6 @@ void PlayerAI::FixedUpdate()
         m_input.goDownDown = true;
     }
 
-    printf("dist x %f  et is grounded %d\n ", dist.x, m_player->m_isGrounded);
-
     if (dist.x > 0.5 || dist.x <0.5)
     {
         if (dist.x > 0.5)
@@ -74,7 +72,17 @@ void PlayerAI::FixedUpdate()
     }
    
    
-    m_delayBeforeCheck = 0.2;
+    // Rflchit moins souvent lorsque les pas fixes sont surchargs.
+    // La roue des minuteries est partage : la minuterie est cre aprs la phase parallle.
+    const float checkDelay = m_scene->IsFixedStepOverloaded() ? 0.4f : 0.2f;
+    m_checkPending = true;
+    context.Defer([this, checkDelay]()
+    {
+        m_checkTimer = m_scene->GetFixedTimers().Schedule(checkDelay, [this]()
+        {
+            m_checkPending = false;
+        });
+    });
    
     
     
@@ -17,7 +17,10 @@ public:
     PlayerAI(Player *player);
     virtual ~PlayerAI();
 
-    virtual void FixedUpdate();
+    /// @brief Choisit les entres du joueur  chaque pas fixe.
+    /// Appele pendant la phase parallle : l'IA ne modifie que ses propres
+    /// donnes et lit l'tat des joueurs, fig aprs le pas du moteur physique.
+    virtual void ParallelFixedUpdate(FixedUpdateContext &context);
 
     const PlayerInput &GetInput() const;
 
@@ -33,7 +36,13 @@ protected:
     Player *m_target;
     b2AABB m_stageBox;
 
-    float m_delayBeforeCheck;
+    /// @brief Minuterie espaant les changements de direction.
+    TimerHandle m_checkTimer;
+
+    /// @brief Boolen indiquant si m_checkTimer est active.
+    /// Il est modifi sur le thread principal (programmation et expiration
+    /// de la minuterie) : la phase parallle ne lit pas la roue des minuteries.
+    bool m_checkPending;
     bool hasjump;
 
     bool IsInDanger() const;
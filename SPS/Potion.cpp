@@ -8,9 +8,10 @@
 #include "Player.h"
 
 Potion::Potion(Scene *scene) :
-    Damager(scene, LAYER_TERRAIN), m_used(false)
+    Damager(scene, LAYER_TERRAIN), m_used(false), m_animator(scene->GetAnimationSystem())
 {
     SetName("Potion");
+    SetContactEvents(CONTACT_NONE);
 
     AssetManager *assets = scene->GetAssetManager();
     SpriteSheet *spriteSheet = assets->GetSpriteSheet(SHEET_ITEM_POTION);
@@ -32,6 +33,12 @@ Potion::~Potion()
 {
 }
 
+void Potion::Reset()
+{
+    m_used = false;
+    m_animator.PlayAnimation("Potion");
+}
+
 void Potion::Start()
 {
     b2World &world = m_scene->GetWorld();
@@ -87,7 +94,7 @@ void Potion::Render()
     if (body == nullptr) return;
 
     // TODO : decommenter  pour afficher la potion
-    const float angle = body->GetAngle() / b2_pi * 180.f;
+    const float angle = GetInterpolatedTransform().q.GetAngle() / b2_pi * 180.f;
     SDL_Texture *texture = m_animator.GetTexture();
     if (texture)
     {
@@ -102,11 +109,6 @@ void Potion::Render()
     }
 }
 
-void Potion::FixedUpdate()
-{
-    m_animator.Update(m_scene->GetDelta());
-}
-
 bool Potion::TakeDamage(const Damage &damage, Damager *damager)
 {
     if (m_used) return false;
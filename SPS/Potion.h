@@ -14,11 +14,13 @@ class Potion : public Damager
 {
 public:
     Potion(Scene *scene);
+
+    /// @brief Rinitialise l'objet lorsqu'il est recycl par son pool.
+    void Reset();
     virtual ~Potion();
 
     virtual void Start() override;
     virtual void Render() override;
-    virtual void FixedUpdate() override;
 
     virtual bool TakeDamage(const Damage &damage, Damager *damager);
 
@@ -0,0 +1,438 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "StageData.h"
+#include "../GameEngine/AssetWatcher.h"
+
+namespace
+{
+    struct SheetName
+    {
+        const char *name;
+        int sheetID;
+    };
+
+    const SheetName g_sheetNames[] = {
+        { "TilesetRocky", SHEET_TILESET_ROCKY },
+        { "TilesetCity", SHHET_TILESET_CITY },
+        { "TilesetCityBlank", SHHET_TILESET_CITY_BLANK },
+    };
+
+    const char *g_anchorNames[] = {
+        "NorthWest", "NorthEast", "North",
+        "East", "Center", "West",
+        "SouthWest", "South", "SouthEast"
+    };
+
+    bool ReadVec2(cJSON *jVec, b2Vec2 &vec)
+    {
+        if (cJSON_IsArray(jVec) == false || cJSON_GetArraySize(jVec) != 2)
+            return false;
+
+        vec.x = (float)cJSON_GetNumberValue(cJSON_GetArrayItem(jVec, 0));
+        vec.y = (float)cJSON_GetNumberValue(cJSON_GetArrayItem(jVec, 1));
+        return true;
+    }
+
+    float ReadFloat(cJSON *json, const char *name, float defaultValue)
+    {
+        cJSON *jValue = cJSON_GetObjectItem(json, name);
+        return cJSON_IsNumber(jValue) ? (float)cJSON_GetNumberValue(jValue) : defaultValue;
+    }
+}
+
+StageData::StageData() :
+    groups(), tiles(), vertices(), waypoints(), bodies(), spawnPoints(),
+    cameraMinWidth(18.f), cameraMaxWidth(26.f)
+{
+    cameraBounds.lowerBound = b2Vec2(-17.f, -5.f);
+    cameraBounds.upperBound = b2Vec2(+17.f, +13.f);
+}
+
+void StageData::Clear()
+{
+    groups.clear();
+    tiles.clear();
+    vertices.clear();
+    waypoints.clear();
+    bodies.clear();
+    spawnPoints.clear();
+}
+
+int StageData::Load(const std::string &path)
+{
+    PROFILE_SCOPE("StageData::Load");
+
+    const std::string binPath = path + ".stage";
+    const std::string jsonPath = path + ".json";
+
+    int64_t binTime = AssetWatcher::GetWriteTime(binPath);
+    int64_t jsonTime = AssetWatcher::GetWriteTime(jsonPath);
+
+    if (binTime >= 0 && binTime >= jsonTime)
+    {
+        if (LoadBinary(binPath) == EXIT_SUCCESS) return EXIT_SUCCESS;
+    }
+
+    // Recompile le niveau depuis sa description JSON
+    if (ImportJSON(jsonPath) == EXIT_FAILURE) return EXIT_FAILURE;
+
+    if (SaveBinary(binPath) == EXIT_FAILURE)
+    {
+        std::cout << "ERROR - The stage " << binPath << " cannot be saved" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
+
+int StageData::LoadBinary(const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return EXIT_FAILURE;
+
+    // Taille du fichier, pour vrifier l'en-tte avant toute allocation
+    long fileSize = -1;
+    if (fseek(file, 0, SEEK_END) == 0) fileSize = ftell(file);
+    bool success = (fileSize >= 0) && (fseek(file, 0, SEEK_SET) == 0);
+
+    FileHeader header = { 0 };
+    success = success && (fread(&header, sizeof(FileHeader), 1, file) == 1);
+    success = success && (header.magic == STAGE_DATA_MAGIC);
+    success = success && (header.version == STAGE_DATA_VERSION);
+
+    // Un fichier tronqu ou corrompu ne doit pas provoquer d'allocation dmesure
+    if (success)
+    {
+        uint64_t expectedSize = sizeof(FileHeader);
+        expectedSize += (uint64_t)header.groupCount * sizeof(StageGroupData);
+        expectedSize += (uint64_t)header.tileCount * sizeof(StageTileData);
+        expectedSize += (uint64_t)header.vertexCount * sizeof(b2Vec2);
+        expectedSize += (uint64_t)header.waypointCount * sizeof(StageWaypointData);
+        expectedSize += (uint64_t)header.bodyCount * sizeof(StageBodyData);
+        expectedSize += (uint64_t)header.spawnCount * sizeof(b2Vec2);
+        success = (expectedSize == (uint64_t)fileSize);
+        success = success && (header.bodyCount > 0) && (header.spawnCount > 0);
+    }
+
+    if (success)
+    {
+        groups.resize(header.groupCount);
+        tiles.resize(header.tileCount);
+        vertices.resize(header.vertexCount);
+        waypoints.resize(header.waypointCount);
+        bodies.resize(header.bodyCount);
+        spawnPoints.resize(header.spawnCount);
+
+        // Chaque tableau est lu en une seule fois
+        success = success && fread(groups.data(), sizeof(StageGroupData), groups.size(), file) == groups.size();
+        success = success && fread(tiles.data(), sizeof(StageTileData), tiles.size(), file) == tiles.size();
+        success = success && fread(vertices.data(), sizeof(b2Vec2), vertices.size(), file) == vertices.size();
+        success = success && fread(waypoints.data(), sizeof(StageWaypointData), waypoints.size(), file) == waypoints.size();
+        success = success && fread(bodies.data(), sizeof(StageBodyData), bodies.size(), file) == bodies.size();
+        success = success && fread(spawnPoints.data(), sizeof(b2Vec2), spawnPoints.size(), file) == spawnPoints.size();
+
+        cameraBounds = header.cameraBounds;
+        cameraMinWidth = header.cameraMinWidth;
+        cameraMaxWidth = header.cameraMaxWidth;
+    }
+    fclose(file);
+
+    // Vrifie les intervalles des corps
+    for (const StageBodyData &body : bodies)
+    {
+        success = success && ((uint64_t)body.firstTile + body.tileCount <= tiles.size());
+        success = success && ((uint64_t)body.firstVertex + body.vertexCount <= vertices.size());
+        success = success && ((uint64_t)body.firstWaypoint + body.waypointCount <= waypoints.size());
+    }
+    for (const StageTileData &tile : tiles)
+    {
+        success = success && (tile.groupID < groups.size());
+    }
+
+    // Les noms des groupes sont compars avec strcmp()
+    for (const StageGroupData &group : groups)
+    {
+        success = success && (memchr(group.name, '\0', STAGE_GROUP_NAME_SIZE) != nullptr);
+    }
+
+    if (success == false)
+    {
+        std::cout << "ERROR - Invalid stage file " << path << std::endl;
+        Clear();
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int StageData::SaveBinary(const std::string &path) const
+{
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) return EXIT_FAILURE;
+
+    FileHeader header = { 0 };
+    header.magic = STAGE_DATA_MAGIC;
+    header.version = STAGE_DATA_VERSION;
+    header.groupCount = (uint32_t)groups.size();
+    header.tileCount = (uint32_t)tiles.size();
+    header.vertexCount = (uint32_t)vertices.size();
+    header.waypointCount = (uint32_t)waypoints.size();
+    header.bodyCount = (uint32_t)bodies.size();
+    header.spawnCount = (uint32_t)spawnPoints.size();
+    header.cameraBounds = cameraBounds;
+    header.cameraMinWidth = cameraMinWidth;
+    header.cameraMaxWidth = cameraMaxWidth;
+
+    bool success = (fwrite(&header, sizeof(FileHeader), 1, file) == 1);
+    success = success && fwrite(groups.data(), sizeof(StageGroupData), groups.size(), file) == groups.size();
+    success = success && fwrite(tiles.data(), sizeof(StageTileData), tiles.size(), file) == tiles.size();
+    success = success && fwrite(vertices.data(), sizeof(b2Vec2), vertices.size(), file) == vertices.size();
+    success = success && fwrite(waypoints.data(), sizeof(StageWaypointData), waypoints.size(), file) == waypoints.size();
+    success = success && fwrite(bodies.data(), sizeof(StageBodyData), bodies.size(), file) == bodies.size();
+    success = success && fwrite(spawnPoints.data(), sizeof(b2Vec2), spawnPoints.size(), file) == spawnPoints.size();
+
+    fclose(file);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int StageData::ImportJSON(const std::string &path)
+{
+    Clear();
+
+    // Lit le fichier et rcupre le contenu dans un buffer
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        std::cout << "ERROR - The file " << path << " cannot be opened" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+
+    char *buffer = (char *)calloc(fileSize + 1, sizeof(char));
+    AssertNew(buffer);
+
+    rewind(file);
+    fread(buffer, 1, fileSize, file);
+    fclose(file);
+
+    cJSON *json = cJSON_ParseWithLength(buffer, fileSize);
+    free(buffer);
+
+    if (json == nullptr)
+    {
+        std::cout << "ERROR - Parse stage " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int exitStatus = EXIT_SUCCESS;
+
+    // Camra
+    cJSON *jCamera = cJSON_GetObjectItem(json, "camera");
+    if (cJSON_IsObject(jCamera))
+    {
+        cJSON *jBounds = cJSON_GetObjectItem(jCamera, "bounds");
+        if (cJSON_IsArray(jBounds) && cJSON_GetArraySize(jBounds) == 4)
+        {
+            cameraBounds.lowerBound.x = (float)cJSON_GetNumberValue(cJSON_GetArrayItem(jBounds, 0));
+            cameraBounds.lowerBound.y = (float)cJSON_GetNumberValue(cJSON_GetArrayItem(jBounds, 1));
+            cameraBounds.upperBound.x = (float)cJSON_GetNumberValue(cJSON_GetArrayItem(jBounds, 2));
+            cameraBounds.upperBound.y = (float)cJSON_GetNumberValue(cJSON_GetArrayItem(jBounds, 3));
+        }
+        cameraMinWidth = ReadFloat(jCamera, "minWidth", cameraMinWidth);
+        cameraMaxWidth = ReadFloat(jCamera, "maxWidth", cameraMaxWidth);
+    }
+
+    // Positions de dpart des joueurs
+    cJSON *jSpawn = NULL;
+    cJSON_ArrayForEach(jSpawn, cJSON_GetObjectItem(json, "spawns"))
+    {
+        b2Vec2 spawnPoint;
+        if (ReadVec2(jSpawn, spawnPoint)) spawnPoints.push_back(spawnPoint);
+        else exitStatus = EXIT_FAILURE;
+    }
+
+    // Corps
+    cJSON *jBody = NULL;
+    cJSON_ArrayForEach(jBody, cJSON_GetObjectItem(json, "bodies"))
+    {
+        if (ImportBody(jBody) == EXIT_FAILURE) exitStatus = EXIT_FAILURE;
+    }
+
+    cJSON_Delete(json);
+
+    if (spawnPoints.empty() || bodies.empty())
+    {
+        exitStatus = EXIT_FAILURE;
+    }
+    if (exitStatus == EXIT_FAILURE)
+    {
+        std::cout << "ERROR - Invalid stage " << path << std::endl;
+        Clear();
+    }
+    return exitStatus;
+}
+
+int StageData::ImportBody(cJSON *jBody)
+{
+    StageBodyData body = { 0 };
+
+    cJSON *jType = cJSON_GetObjectItem(jBody, "type");
+    const char *typeName = cJSON_IsString(jType) ? cJSON_GetStringValue(jType) : "static";
+    if (strcmp(typeName, "static") == 0) body.type = (int32_t)b2_staticBody;
+    else if (strcmp(typeName, "kinematic") == 0) body.type = (int32_t)b2_kinematicBody;
+    else return EXIT_FAILURE;
+
+    body.position = b2Vec2_zero;
+    cJSON *jPosition = cJSON_GetObjectItem(jBody, "position");
+    if (jPosition && ReadVec2(jPosition, body.position) == false) return EXIT_FAILURE;
+
+    const float scale = ReadFloat(jBody, "scale", 1.f);
+    const float pixelsPerUnit = ReadFloat(jBody, "pixelsPerUnit", 16.f);
+    body.friction = ReadFloat(jBody, "friction", 0.5f);
+    body.restitution = ReadFloat(jBody, "restitution", 0.f);
+    body.oneWay = cJSON_IsTrue(cJSON_GetObjectItem(jBody, "oneWay")) ? 1 : 0;
+
+    // Chane de collision
+    body.firstVertex = (uint32_t)vertices.size();
+    cJSON *jVertex = NULL;
+    cJSON_ArrayForEach(jVertex, cJSON_GetObjectItem(jBody, "chain"))
+    {
+        b2Vec2 vertex;
+        if (ReadVec2(jVertex, vertex) == false) return EXIT_FAILURE;
+        vertices.push_back(scale * vertex);
+    }
+    body.vertexCount = (uint32_t)vertices.size() - body.firstVertex;
+    if (body.vertexCount > 0 && body.vertexCount < 3) return EXIT_FAILURE;
+
+    // Tuiles
+    body.firstTile = (uint32_t)tiles.size();
+    cJSON *jTile = NULL;
+    cJSON_ArrayForEach(jTile, cJSON_GetObjectItem(jBody, "tiles"))
+    {
+        if (ImportTile(jTile, scale, pixelsPerUnit) == EXIT_FAILURE) return EXIT_FAILURE;
+    }
+    body.tileCount = (uint32_t)tiles.size() - body.firstTile;
+
+    // Trajet
+    body.firstWaypoint = (uint32_t)waypoints.size();
+    cJSON *jWaypoint = NULL;
+    cJSON_ArrayForEach(jWaypoint, cJSON_GetObjectItem(jBody, "path"))
+    {
+        StageWaypointData waypoint = { };
+        if (ReadVec2(cJSON_GetObjectItem(jWaypoint, "position"), waypoint.position) == false)
+            return EXIT_FAILURE;
+
+        waypoint.smoothTime = ReadFloat(jWaypoint, "smoothTime", 1.f);
+        waypoint.duration = ReadFloat(jWaypoint, "duration", 0.f);
+        waypoints.push_back(waypoint);
+    }
+    body.waypointCount = (uint32_t)waypoints.size() - body.firstWaypoint;
+
+    bodies.push_back(body);
+    return EXIT_SUCCESS;
+}
+
+int StageData::ImportTile(cJSON *jTile, float scale, float pixelsPerUnit)
+{
+    cJSON *jSheet = cJSON_GetObjectItem(jTile, "sheet");
+    cJSON *jGroup = cJSON_GetObjectItem(jTile, "group");
+    if (cJSON_IsString(jSheet) == false || cJSON_IsString(jGroup) == false)
+        return EXIT_FAILURE;
+
+    int groupID = GetGroupID(cJSON_GetStringValue(jSheet), cJSON_GetStringValue(jGroup));
+    if (groupID < 0) return EXIT_FAILURE;
+
+    StageTileData tile = { 0 };
+    tile.groupID = (uint16_t)groupID;
+    tile.spriteIdx = (uint16_t)ReadFloat(jTile, "index", 0.f);
+    tile.pixelsPerUnit = pixelsPerUnit / scale;
+    tile.anchor = (uint8_t)Anchor::NORTH_WEST;
+    tile.flip = (uint8_t)SDL_FLIP_NONE;
+
+    cJSON *jAnchor = cJSON_GetObjectItem(jTile, "anchor");
+    if (cJSON_IsString(jAnchor))
+    {
+        const char *anchorName = cJSON_GetStringValue(jAnchor);
+        int anchor = 0;
+        for (; anchor < 9; anchor++)
+        {
+            if (strcmp(anchorName, g_anchorNames[anchor]) == 0) break;
+        }
+        if (anchor == 9) return EXIT_FAILURE;
+        tile.anchor = (uint8_t)anchor;
+    }
+
+    cJSON *jFlip = cJSON_GetObjectItem(jTile, "flip");
+    if (cJSON_IsString(jFlip))
+    {
+        const char *flipName = cJSON_GetStringValue(jFlip);
+        if (strcmp(flipName, "horizontal") == 0) tile.flip = (uint8_t)SDL_FLIP_HORIZONTAL;
+        else if (strcmp(flipName, "vertical") == 0) tile.flip = (uint8_t)SDL_FLIP_VERTICAL;
+        else if (strcmp(flipName, "none") != 0) return EXIT_FAILURE;
+    }
+
+    b2Vec2 position, step(1.f, 1.f);
+    if (ReadVec2(cJSON_GetObjectItem(jTile, "position"), position) == false)
+        return EXIT_FAILURE;
+
+    cJSON *jStep = cJSON_GetObjectItem(jTile, "step");
+    if (jStep && ReadVec2(jStep, step) == false) return EXIT_FAILURE;
+
+    // Rptition de la tuile sur une grille
+    int repeatX = 1, repeatY = 1;
+    cJSON *jRepeat = cJSON_GetObjectItem(jTile, "repeat");
+    if (jRepeat)
+    {
+        b2Vec2 repeat;
+        if (ReadVec2(jRepeat, repeat) == false) return EXIT_FAILURE;
+        repeatX = (int)repeat.x;
+        repeatY = (int)repeat.y;
+    }
+
+    for (int i = 0; i < repeatX; i++)
+    {
+        for (int j = 0; j < repeatY; j++)
+        {
+            tile.position.x = scale * (position.x + (float)i * step.x);
+            tile.position.y = scale * (position.y + (float)j * step.y);
+            tiles.push_back(tile);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+int StageData::GetGroupID(const char *sheetName, const char *groupName)
+{
+    int sheetID = -1;
+    for (const SheetName &sheet : g_sheetNames)
+    {
+        if (strcmp(sheet.name, sheetName) == 0)
+        {
+            sheetID = sheet.sheetID;
+            break;
+        }
+    }
+    if (sheetID < 0 || strlen(groupName) >= STAGE_GROUP_NAME_SIZE)
+    {
+        std::cout << "ERROR - Unknown sprite group " << sheetName << "/" << groupName << std::endl;
+        return -1;
+    }
+
+    for (int i = 0; i < (int)groups.size(); i++)
+    {
+        if (groups[i].sheetID == sheetID && strcmp(groups[i].name, groupName) == 0)
+        {
+            return i;
+        }
+    }
+
+    StageGroupData group = { 0 };
+    group.sheetID = sheetID;
+    strncpy(group.name, groupName, STAGE_GROUP_NAME_SIZE - 1);
+    groups.push_back(group);
+
+    return (int)groups.size() - 1;
+}
@@ -0,0 +1,117 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "GameSettings.h"
+#include "GameCommon.h"
+
+/// @brief Identifiant des fichiers de niveau binaires ("SPSG").
+#define STAGE_DATA_MAGIC 0x47535053
+#define STAGE_DATA_VERSION 2
+
+#define STAGE_GROUP_NAME_SIZE 28
+
+/// @brief Groupe de sprites rfrenc par les tuiles d'un niveau.
+struct StageGroupData
+{
+    int32_t sheetID;
+    char name[STAGE_GROUP_NAME_SIZE];
+};
+
+/// @brief Tuile d'un niveau, dj mise  l'chelle de son corps.
+struct StageTileData
+{
+    uint16_t groupID;
+    uint16_t spriteIdx;
+    b2Vec2 position;
+    float pixelsPerUnit;
+    uint8_t anchor;
+    uint8_t flip;
+    uint16_t padding;
+};
+
+/// @brief tape du trajet d'une plateforme mobile (voir PathKey).
+typedef PathKey StageWaypointData;
+
+/// @brief Corps d'un niveau (sol ou plateforme).
+/// Ses tuiles, les sommets de sa chane de collision et les tapes
+/// de son trajet sont des intervalles des tableaux de StageData.
+struct StageBodyData
+{
+    int32_t type;
+    b2Vec2 position;
+    float friction;
+    float restitution;
+    int32_t oneWay;
+
+    uint32_t firstTile;
+    uint32_t tileCount;
+    uint32_t firstVertex;
+    uint32_t vertexCount;
+    uint32_t firstWaypoint;
+    uint32_t waypointCount;
+};
+
+/// @brief Description complte d'un niveau, stocke dans des tableaux contigus.
+/// Le fichier binaire contient un en-tte suivi de chaque tableau,
+/// lus chacun en une seule fois. Il est produit  partir d'un fichier JSON
+/// dit  la main (voir ImportJSON()).
+class StageData
+{
+public:
+    StageData();
+
+    /// @brief Charge le niveau depuis son fichier binaire.
+    /// Le fichier binaire est d'abord recompil depuis le fichier JSON
+    /// s'il est absent ou plus ancien que le fichier JSON.
+    /// @param path le chemin du niveau, sans extension (".stage" et ".json").
+    /// @return EXIT_SUCCESS ou EXIT_FAILURE.
+    int Load(const std::string &path);
+
+    int LoadBinary(const std::string &path);
+    int SaveBinary(const std::string &path) const;
+
+    /// @brief Lit la description d'un niveau au format JSON.
+    /// Les tuiles peuvent tre rptes sur une grille ("repeat" et "step"),
+    /// l'chelle de chaque corps est applique aux tuiles et aux sommets.
+    /// @param path le chemin du fichier JSON.
+    /// @return EXIT_SUCCESS ou EXIT_FAILURE.
+    int ImportJSON(const std::string &path);
+
+    void Clear();
+
+    std::vector<StageGroupData> groups;
+    std::vector<StageTileData> tiles;
+    std::vector<b2Vec2> vertices;
+    std::vector<StageWaypointData> waypoints;
+    std::vector<StageBodyData> bodies;
+    std::vector<b2Vec2> spawnPoints;
+
+    b2AABB cameraBounds;
+    float cameraMinWidth;
+    float cameraMaxWidth;
+
+private:
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t groupCount;
+        uint32_t tileCount;
+        uint32_t vertexCount;
+        uint32_t waypointCount;
+        uint32_t bodyCount;
+        uint32_t spawnCount;
+        b2AABB cameraBounds;
+        float cameraMinWidth;
+        float cameraMaxWidth;
+    };
+
+    int ImportBody(cJSON *jBody);
+    int ImportTile(cJSON *jTile, float scale, float pixelsPerUnit);
+    int GetGroupID(const char *sheetName, const char *groupName);
+};
@@ -11,13 +11,9 @@
 #include "FireWarrior.h"
 #include "LightningWarrior.h"
 
-#include "RockyPassStage.h"
-#include "platformD.h"
-#include "platformG.h"
+#include "StageTerrain.h"
+#include "KillZone.h"
 #include "Background.h"
-#include "City.h"
-#include "PlatformGBis.h"
-#include "PlatformDBis.h"
 
 
 #include "Potion.h"
@@ -55,17 +51,20 @@ StageManager::StageManager(
     // Stage
     if (m_mapConfig ==1 )
     {
+        InitStage("../Assets/Stage/RockyPass");
         InitRockyPass();
-        InitPlatform();
     }
     else if (m_mapConfig == 2)
     {
+        InitStage("../Assets/Stage/City");
         InitCity();
-        InitPlatformBis();
     }
 
     // Crée la caméra
-    SetMainCamera(new MainCamera(scene));
+    MainCamera *camera = new MainCamera(scene);
+    camera->SetWorldBounds(m_stageData.cameraBounds);
+    camera->SetWidthRange(m_stageData.cameraMinWidth, m_stageData.cameraMaxWidth);
+    SetMainCamera(camera);
 
 
     if (true)
@@ -73,11 +72,6 @@ StageManager::StageManager(
         m_delayStage = (float)stageConfig.duration * 60.f;
     }
 
-    b2Vec2 startPositions[4] = {
-        b2Vec2(-6.f, 0.05f), b2Vec2(+6.f, 0.05f),
-        b2Vec2(-2.f, 0.05f), b2Vec2(+2.f, 0.05f),
-    };
-
     // Initialisation des stats
     int playerID = 0;
     for (PlayerConfig &config : playerConfigs)
@@ -112,12 +106,17 @@ StageManager::StageManager(
             player = new LightningWarrior(scene, config, stats);
             break;
         }
-        player->SetStartPosition(startPositions[i % 4]);
+        const std::vector<b2Vec2> &spawnPoints = m_stageData.spawnPoints;
+        player->SetStartPosition(spawnPoints[i % spawnPoints.size()]);
 
         m_players.push_back(player);
     }
 
-   
+    // Les joueurs qui sortent de ces limites sont mis KO
+    b2AABB killBounds;
+    killBounds.lowerBound.Set(-40.f, -5.f);
+    killBounds.upperBound.Set(+40.f, +25.f);
+    new KillZone(scene, killBounds);
 
     // Crée l'interface utilisateur
     m_stageHUD = new UIStageHUD(scene);
@@ -138,8 +137,11 @@ StageManager::StageManager(
     case StageConfig::Bomb::RAPIDE:m_MaxDelayBomb = 15; break;
 
     }
-   
-    
+
+    // Les objets ramassables sont recyclés plutôt que détruits
+    scene->GetObjectPool<Potion>().SetRecycling(true);
+    scene->GetObjectPool<JumpPotion>().SetRecycling(true);
+    scene->GetObjectPool<Bomb>().SetRecycling(true);
 }
 
 StageManager::~StageManager()
@@ -283,7 +285,7 @@ StageManager *StageManager::GetFromScene(Scene *scene)
 void StageManager::AddPotion()
 {
     Scene *scene = GetScene();
-    Potion *potion = new Potion(scene);
+    Potion *potion = scene->GetObjectPool<Potion>().Create();
     b2Vec2 position(Random::RangeF(-7.f, 7.f), 10.f); 
    // b2Vec2 position(10.f, 10.f);
     potion->SetStartPosition(position);  
@@ -297,7 +299,7 @@ void StageManager::AddPotion()
 void StageManager::AddJumpPotion()
 {
     Scene* scene = GetScene();
-    JumpPotion * potion = new JumpPotion(scene); 
+    JumpPotion * potion = scene->GetObjectPool<JumpPotion>().Create();
     b2Vec2 position(Random::RangeF(-7.f, 7.f), 10.f);
     // b2Vec2 position(10.f, 10.f);
     potion->SetStartPosition(position);
@@ -312,7 +314,7 @@ void StageManager::AddJumpPotion()
 void StageManager::AddBomb()
 {
     Scene* scene = GetScene();
-    Bomb* bomb = new Bomb(scene);
+    Bomb* bomb = scene->GetObjectPool<Bomb>().Create();
     b2Vec2 position(Random::RangeF(-7.f, 7.f), 10.f);
     // b2Vec2 position(10.f, 10.f);
     bomb->SetStartPosition(position);
@@ -338,12 +340,40 @@ void StageManager::AddBomb()
 //    }
 //}
 
-void StageManager::InitRockyPass()
+void StageManager::InitStage(const std::string &path)
 {
     Scene *scene = GetScene();
+    AssetManager *assets = scene->GetAssetManager();
 
-    // Stage
-    RockyPassStage *stage = new RockyPassStage(scene);
+    if (m_stageData.Load(path) == EXIT_FAILURE)
+    {
+        std::cout << "ERROR - Load stage " << path << std::endl;
+        assert(false);
+        abort();
+    }
+
+    // Récupère une seule fois les groupes de sprites du niveau
+    std::vector<SpriteGroup *> groups;
+    groups.reserve(m_stageData.groups.size());
+    for (const StageGroupData &groupData : m_stageData.groups)
+    {
+        SpriteSheet *spriteSheet = assets->GetSpriteSheet(groupData.sheetID);
+        AssertNew(spriteSheet);
+        SpriteGroup *spriteGroup = spriteSheet->GetGroup(groupData.name);
+        AssertNew(spriteGroup);
+        groups.push_back(spriteGroup);
+    }
+
+    // Crée les corps et leurs tuiles depuis les tableaux du niveau
+    for (int i = 0; i < (int)m_stageData.bodies.size(); i++)
+    {
+        new StageTerrain(scene, m_stageData, i, groups);
+    }
+}
+
+void StageManager::InitRockyPass()
+{
+    Scene *scene = GetScene();
 
     // Background
     AssetManager *assets = scene->GetAssetManager();
@@ -369,45 +399,10 @@ void StageManager::InitRockyPass()
 }
 
 
-void StageManager::InitPlatform()
-{
-    Scene* scene = GetScene();
-
-    // Stage
-    PlatformG* stageG = new PlatformG(scene, LAYER_TERRAIN, b2Vec2(-19, -2)); 
-    PlatformD* stageD = new PlatformD(scene, LAYER_TERRAIN,b2Vec2(15, -2));
-
-    scene->GetAssetManager()->FadeInMusic(MUSIC_ROCKY_PASS);
-
-    // platform 2 
-}
-
-
-void StageManager::InitPlatformBis()
-{
-    Scene* scene = GetScene();
-
-    // Stage
-       CityG *stageG = new CityG(scene, LAYER_TERRAIN, b2Vec2(-19, -2));  
-       CityD *stageD = new CityD(scene, LAYER_TERRAIN, b2Vec2(15, -2));    
-
-    // Music
-    scene->GetAssetManager()->FadeInMusic(MUSIC_ROCKY_PASS);
-
-    // platform 2 
-}
-
-
 void StageManager::InitCity()
 {
     Scene* scene = GetScene();
 
-    // Stage
-    City* stage = new City(scene);
-     
-
-
-
     // Background
     AssetManager* assets = scene->GetAssetManager();
     Background* background = new Background(scene, LAYER_BACKGROUND);
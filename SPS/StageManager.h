@@ -12,6 +12,7 @@
 
 #include "Player.h"
 #include "MainCamera.h"
+#include "StageData.h"
 
 #include "UIPauseMenu.h"
 #include "UIStageHUD.h"
@@ -54,11 +55,10 @@ public:
 
 
 private:
+    /// @brief Charge le niveau et cre ses corps.
+    /// @param path le chemin du niveau, sans extension.
+    void InitStage(const std::string &path);
     void InitRockyPass();
-    
-    
-    void InitPlatform();
-    void InitPlatformBis();
     void InitCity();
 
     void AddPotion();
@@ -90,6 +90,8 @@ private:
     float m_delayBomb; // ADD
     float m_MaxDelayBomb;
     int m_mapConfig;
+
+    StageData m_stageData;
    
 
 };
@@ -0,0 +1,116 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "StageTerrain.h"
+#include "Player.h"
+
+StageTerrain::StageTerrain(
+    Scene *scene, const StageData &stageData, int bodyID,
+    const std::vector<SpriteGroup *> &groups) :
+    Terrain(scene, LAYER_TERRAIN),
+    m_bodyType(b2_staticBody), m_startPosition(b2Vec2_zero),
+    m_friction(0.5f), m_restitution(0.f),
+    m_vertices(), m_mover(), m_pathStartMS(0), m_bodies()
+{
+    SetName("StageTerrain");
+
+    assert(0 <= bodyID && bodyID < (int)stageData.bodies.size());
+    const StageBodyData &body = stageData.bodies[bodyID];
+
+    m_bodyType = (b2BodyType)body.type;
+    m_startPosition = body.position;
+    m_friction = body.friction;
+    m_restitution = body.restitution;
+    SetOneWay(body.oneWay != 0);
+
+    const b2Vec2 *vertices = stageData.vertices.data() + body.firstVertex;
+    m_vertices.assign(vertices, vertices + body.vertexCount);
+
+    if (m_bodyType == b2_kinematicBody)
+    {
+        const StageWaypointData *waypoints = stageData.waypoints.data() + body.firstWaypoint;
+        m_mover.SetPath(m_startPosition, waypoints, (int)body.waypointCount);
+    }
+
+    // Cre les tuiles d'un bloc, elles sont dj  l'chelle
+    m_tiles.reserve(body.tileCount);
+    Tile tile;
+    for (uint32_t i = 0; i < body.tileCount; i++)
+    {
+        const StageTileData &tileData = stageData.tiles[body.firstTile + i];
+        SpriteGroup *spriteGroup = groups[tileData.groupID];
+
+        tile.Reset(tileData.pixelsPerUnit);
+        if (spriteGroup) tile.SetSprite(spriteGroup, tileData.spriteIdx);
+        tile.position = tileData.position;
+        tile.anchor = (Anchor)tileData.anchor;
+        tile.flip = (SDL_RendererFlip)tileData.flip;
+        m_tiles.push_back(tile);
+    }
+}
+
+StageTerrain::~StageTerrain()
+{
+}
+
+void StageTerrain::Start()
+{
+    b2BodyDef bodyDef;
+    bodyDef.type = m_bodyType;
+    bodyDef.position = m_startPosition;
+    bodyDef.angle = 0.f;
+
+    CreateBody(&bodyDef);
+    m_pathStartMS = m_scene->GetFixedElapsedMS();
+
+    if (m_vertices.size() < 3) return;
+
+    b2ChainShape chain;
+    chain.CreateLoop(m_vertices.data(), (int)m_vertices.size());
+
+    b2FixtureDef fixtureDef;
+    fixtureDef.shape = &chain;
+    fixtureDef.density = 1.f;
+    fixtureDef.friction = m_friction;
+    fixtureDef.restitution = m_restitution;
+    fixtureDef.filter.categoryBits = CATEGORY_TERRAIN;
+
+    b2Fixture *fixture = CreateFixture(&fixtureDef);
+    AssertNew(fixture);
+}
+
+void StageTerrain::FixedUpdate()
+{
+    Terrain::FixedUpdate();
+
+    b2Body *body = GetBody();
+    if (body == nullptr || m_mover.IsEmpty()) return;
+
+    // Le trajet ne dpend que du temps coul depuis le dbut du niveau
+    const float time = (float)(m_scene->GetFixedElapsedMS() - m_pathStartMS) / 1000.f;
+    m_mover.Step(body, time, m_scene->GetDelta());
+
+    ApplyExternalVelocity();
+}
+
+void StageTerrain::ApplyExternalVelocity()
+{
+    b2Vec2 extVelocity = GetVelocity();
+    extVelocity.y *= 0.5f;
+
+    for (GameBody *gameBody : m_bodies)
+    {
+        if (m_scene->Contains(gameBody) == false) continue;
+
+        Player *player = dynamic_cast<Player *>(gameBody);
+        if (player)
+        {
+            player->AddExternalVelocity(extVelocity);
+        }
+    }
+
+    m_bodies.clear();
+}
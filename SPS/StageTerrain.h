@@ -0,0 +1,52 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "Terrain.h"
+#include "StageData.h"
+
+/// @brief Corps d'un niveau construit depuis un StageData.
+/// Les corps cinmatiques suivent leur trajet en boucle, valu  partir
+/// du temps des pas fixes, et entranent les joueurs poss dessus.
+class StageTerrain : public Terrain
+{
+public:
+    /// @brief Construit le corps d'indice bodyID du niveau.
+    /// @param groups les groupes de sprites du niveau, dans l'ordre de stageData.groups.
+    StageTerrain(
+        Scene *scene, const StageData &stageData, int bodyID,
+        const std::vector<SpriteGroup *> &groups);
+    virtual ~StageTerrain();
+
+    virtual void Start() override;
+    virtual void FixedUpdate() override;
+
+    void AddGameBody(GameBody *gameBody);
+
+protected:
+    b2BodyType m_bodyType;
+    b2Vec2 m_startPosition;
+    float m_friction;
+    float m_restitution;
+
+    std::vector<b2Vec2> m_vertices;
+
+    KinematicPathMover m_mover;
+    Uint64 m_pathStartMS;
+
+    std::set<GameBody *> m_bodies;
+
+    void ApplyExternalVelocity();
+};
+
+inline void StageTerrain::AddGameBody(GameBody *gameBody)
+{
+    if (m_bodyType == b2_kinematicBody)
+    {
+        m_bodies.insert(gameBody);
+    }
+}
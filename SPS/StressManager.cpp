@@ -0,0 +1,418 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#include "StressManager.h"
+#include "Terrain.h"
+#include "Potion.h"
+#include "Bomb.h"
+
+#ifdef _WIN32
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#  include <psapi.h>
+#else
+#  include <unistd.h>
+#endif
+
+/// @brief Renvoie la mmoire physique utilise par le processus (en octets).
+static size_t GetResidentMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters = { 0 };
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return (size_t)counters.WorkingSetSize;
+    }
+    return 0;
+#else
+    long pageCount = 0, residentCount = 0;
+    FILE *file = fopen("/proc/self/statm", "r");
+    if (file == nullptr) return 0;
+    if (fscanf(file, "%ld %ld", &pageCount, &residentCount) != 2)
+    {
+        residentCount = 0;
+    }
+    fclose(file);
+
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0) return 0;
+    return (size_t)residentCount * (size_t)pageSize;
+#endif
+}
+
+/// @brief Terrain compos de blocs indpendants, chacun avec sa fixture.
+class StressTerrain : public Terrain
+{
+public:
+    StressTerrain(Scene *scene, int tileCount) :
+        Terrain(scene, LAYER_TERRAIN_BACKGROUND), m_tileCount(tileCount)
+    {
+        SetName("StressTerrain");
+
+        AssetManager *assets = m_scene->GetAssetManager();
+        SpriteSheet *spriteSheet = assets->GetSpriteSheet(SHEET_TILESET_ROCKY);
+        AssertNew(spriteSheet);
+        SpriteGroup *floor = spriteSheet->GetGroup("Floor");
+        AssertNew(floor);
+
+        Tile tile;
+        for (int i = 0; i < m_tileCount; i++)
+        {
+            tile.Reset(16.f);
+            tile.SetSprite(floor, 0);
+            tile.position = GetTilePosition(i);
+            AddTile(tile);
+        }
+    }
+
+    virtual void Start() override
+    {
+        b2BodyDef bodyDef;
+        bodyDef.type = b2_staticBody;
+        CreateBody(&bodyDef);
+
+        for (int i = 0; i < m_tileCount; i++)
+        {
+            b2PolygonShape box;
+            box.SetAsBox(0.5f, 0.5f, GetTilePosition(i) + b2Vec2(0.5f, -0.5f), 0.f);
+
+            b2FixtureDef fixtureDef;
+            fixtureDef.shape = &box;
+            fixtureDef.friction = 0.5f;
+            fixtureDef.filter.categoryBits = CATEGORY_TERRAIN;
+            CreateFixture(&fixtureDef);
+        }
+    }
+
+private:
+    b2Vec2 GetTilePosition(int i) const
+    {
+        // Ranges de 40 blocs sous le niveau
+        return b2Vec2((float)(i % 40) - 20.f, -10.f - 2.f * (float)(i / 40));
+    }
+
+    int m_tileCount;
+};
+
+/// @brief Emetteur de particules continu.
+class StressEmitter : public GameObject
+{
+public:
+    StressEmitter(Scene *scene, b2Vec2 position) :
+        GameObject(scene, LAYER_PARTICLES), m_position(position), m_spriteGroup(nullptr)
+    {
+        SetName("StressEmitter");
+
+        AssetManager *assets = m_scene->GetAssetManager();
+        SpriteSheet *spriteSheet = assets->GetSpriteSheet(SHEET_VFX_SMASH);
+        AssertNew(spriteSheet);
+        m_spriteGroup = spriteSheet->GetGroup("SmashPreparation");
+        AssertNew(m_spriteGroup);
+    }
+
+    virtual void Update() override
+    {
+        // Une frame sur deux lorsque les pas fixes sont surchargs
+        if (m_scene->IsFixedStepOverloaded() && (m_scene->GetUpdateID() % 2) != 0)
+            return;
+
+        b2Vec2 position = m_position;
+        position.x += Random::RangeF(-1.f, 1.f);
+        position.y += Random::RangeF(-1.f, 1.f);
+
+        Particle *particle = m_scene->GetParticleSystem(LAYER_PARTICLES)
+            ->EmitParticle(m_spriteGroup, position, 40.f);
+        particle->GetSpriteAnimation()->SetCycleCount(1);
+        particle->SetLifetimeFromAnim();
+        particle->SetVelocity(b2Vec2(Random::RangeF(-1.f, 1.f), 2.f));
+    }
+
+private:
+    b2Vec2 m_position;
+    SpriteGroup *m_spriteGroup;
+};
+
+StressConfig::StressConfig() :
+    enabled(false), cpuCount(MAX_PLAYER_COUNT), bombCount(0), potionCount(0),
+    emitterCount(0), tileCount(0), widgetCount(0),
+    frameCount(600), warmupCount(60), fixedStepAllocBudget(-1), outPath("stress.jsonl")
+{
+}
+
+void StressConfig::ParseArgs(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string option(argv[i]);
+        if (option == "--stress")
+        {
+            enabled = true;
+            continue;
+        }
+        if (option.rfind("--stress-", 0) != 0 || i + 1 >= argc)
+            continue;
+
+        enabled = true;
+        const char *value = argv[++i];
+
+        if (option == "--stress-players") cpuCount = atoi(value);
+        else if (option == "--stress-bombs") bombCount = atoi(value);
+        else if (option == "--stress-potions") potionCount = atoi(value);
+        else if (option == "--stress-emitters") emitterCount = atoi(value);
+        else if (option == "--stress-tiles") tileCount = atoi(value);
+        else if (option == "--stress-widgets") widgetCount = atoi(value);
+        else if (option == "--stress-frames") frameCount = atoi(value);
+        else if (option == "--stress-warmup") warmupCount = atoi(value);
+        else if (option == "--stress-alloc-budget") fixedStepAllocBudget = atoi(value);
+        else if (option == "--stress-out") outPath = value;
+        else
+        {
+            std::cout << "ERROR - Unknown option " << option << std::endl;
+        }
+    }
+
+    // Les joueurs sont limits par les quipes et les contrles
+    cpuCount = Math::Clamp(cpuCount, 1, MAX_PLAYER_COUNT);
+    frameCount = std::max(1, frameCount);
+    warmupCount = std::max(0, warmupCount);
+}
+
+void StressConfig::ApplyTo(
+    std::array<PlayerConfig, MAX_PLAYER_COUNT> &playerConfigs,
+    StageConfig &stageConfig) const
+{
+    for (int i = 0; i < MAX_PLAYER_COUNT; i++)
+    {
+        PlayerConfig &config = playerConfigs[i];
+        config.type = (i % 2) ?
+            PlayerConfig::Type::LIGHTNING_WARRIOR :
+            PlayerConfig::Type::FIRE_WARRIOR;
+        config.SetTeamID(i);
+        config.isCPU = true;
+        config.enabled = (i < cpuCount);
+    }
+
+    stageConfig.mode = StageConfig::Mode::LIMITED_LIVES;
+    stageConfig.lifeCount = 1000;
+    stageConfig.duration = 1000;
+    stageConfig.potionLevel = StageConfig::Potion::AUCUNE;
+    stageConfig.bombLevel = StageConfig::Bomb::AUCUNE;
+}
+
+StressManager::StressManager(
+    InputManager *inputManager,
+    std::array<PlayerConfig, MAX_PLAYER_COUNT> &playerConfigs,
+    StageConfig &stageConfig, const StressConfig &stressConfig) :
+    StageManager(inputManager, playerConfigs, stageConfig),
+    m_stressConfig(stressConfig), m_frameID(0),
+    m_frameTimes(), m_zoneTotals(),
+    m_objectCountSum(0.0), m_bodyCountSum(0.0), m_allocCountSum(0.0), m_peakMemory(0)
+{
+    m_frameTimes.reserve(m_stressConfig.frameCount);
+
+    InitTiles();
+    InitEmitters();
+    InitWidgets();
+    SpawnItems();
+}
+
+StressManager::~StressManager()
+{
+}
+
+void StressManager::InitTiles()
+{
+    if (m_stressConfig.tileCount <= 0) return;
+
+    new StressTerrain(GetScene(), m_stressConfig.tileCount);
+}
+
+void StressManager::InitEmitters()
+{
+    Scene *scene = GetScene();
+    for (int i = 0; i < m_stressConfig.emitterCount; i++)
+    {
+        b2Vec2 position(Random::RangeF(-10.f, 10.f), Random::RangeF(1.f, 8.f));
+        new StressEmitter(scene, position);
+    }
+}
+
+void StressManager::InitWidgets()
+{
+    Scene *scene = GetScene();
+    AssetManager *assets = scene->GetAssetManager();
+    TTF_Font *font = assets->GetFont(FONT_SMALL);
+    AssertNew(font);
+
+    for (int i = 0; i < m_stressConfig.widgetCount; i++)
+    {
+        UIObject *widget = nullptr;
+        if (i % 2)
+        {
+            widget = new UIText(scene, std::to_string(i), font, Color(255, 255, 255));
+        }
+        else
+        {
+            widget = new UIFillRect(scene, Color(
+                (Uint8)Random::RangeI(0, 255), (Uint8)Random::RangeI(0, 255),
+                (Uint8)Random::RangeI(0, 255), 128
+            ));
+        }
+
+        b2Vec2 anchor(Random::RangeF(0.f, 1.f), Random::RangeF(0.f, 1.f));
+        widget->SetLocalRect(UIRect(anchor, anchor, b2Vec2(-8.f, -8.f), b2Vec2(8.f, 8.f)));
+        widget->SetLayer(LAYER_UI);
+    }
+}
+
+void StressManager::SpawnItems()
+{
+    Scene *scene = GetScene();
+
+    // Maintient un nombre constant d'objets ramassables
+    ObjectPool<Potion> &potionPool = scene->GetObjectPool<Potion>();
+    int potionCount = potionPool.GetObjectCount() - potionPool.GetRecycledCount();
+    for (; potionCount < m_stressConfig.potionCount; potionCount++)
+    {
+        Potion *potion = potionPool.Create();
+        potion->SetStartPosition(b2Vec2(Random::RangeF(-7.f, 7.f), Random::RangeF(2.f, 12.f)));
+    }
+
+    ObjectPool<Bomb> &bombPool = scene->GetObjectPool<Bomb>();
+    int bombCount = bombPool.GetObjectCount() - bombPool.GetRecycledCount();
+    for (; bombCount < m_stressConfig.bombCount; bombCount++)
+    {
+        Bomb *bomb = bombPool.Create();
+        bomb->SetStartPosition(b2Vec2(Random::RangeF(-7.f, 7.f), Random::RangeF(2.f, 12.f)));
+    }
+}
+
+void StressManager::OnSceneUpdate()
+{
+    StageManager::OnSceneUpdate();
+
+    m_frameID++;
+    if (m_frameID <= m_stressConfig.warmupCount) return;
+
+    if (m_frameID == m_stressConfig.warmupCount + 1)
+    {
+        // Rgime permanent : les pas fixes ne doivent plus allouer
+        GetScene()->SetFixedStepAllocBudget(m_stressConfig.fixedStepAllocBudget);
+    }
+
+    if ((int)m_frameTimes.size() < m_stressConfig.frameCount)
+    {
+        RecordFrame();
+        if ((int)m_frameTimes.size() == m_stressConfig.frameCount)
+        {
+            WriteResults();
+            QuitGame();
+        }
+    }
+}
+
+void StressManager::OnSceneFixedUpdate()
+{
+    StageManager::OnSceneFixedUpdate();
+    SpawnItems();
+}
+
+void StressManager::RecordFrame()
+{
+    const SceneStats &stats = GetScene()->GetStats();
+
+    m_frameTimes.push_back(Profiler::GetFrameMS());
+    m_objectCountSum += stats.objectCount;
+    m_bodyCountSum += stats.bodyCount;
+    m_allocCountSum += (double)AllocTracker::GetFrameAllocCount();
+    m_peakMemory = std::max(m_peakMemory, GetResidentMemory());
+
+    for (const ProfilerZoneStats &zone : Profiler::GetZoneStats())
+    {
+        ZoneTotal *total = nullptr;
+        for (ZoneTotal &other : m_zoneTotals)
+        {
+            if (strcmp(other.name, zone.name) == 0)
+            {
+                total = &other;
+                break;
+            }
+        }
+        if (total == nullptr)
+        {
+            m_zoneTotals.push_back(ZoneTotal{ zone.name, 0.0 });
+            total = &m_zoneTotals.back();
+        }
+        total->ms += zone.ms;
+    }
+}
+
+void StressManager::WriteResults()
+{
+    const int frameCount = (int)m_frameTimes.size();
+    std::vector<float> sorted(m_frameTimes);
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (float frameTime : sorted)
+    {
+        sum += frameTime;
+    }
+
+    cJSON *json = cJSON_CreateObject();
+    AssertNew(json);
+
+    cJSON *jsonConfig = cJSON_AddObjectToObject(json, "config");
+    cJSON_AddNumberToObject(jsonConfig, "players", m_stressConfig.cpuCount);
+    cJSON_AddNumberToObject(jsonConfig, "bombs", m_stressConfig.bombCount);
+    cJSON_AddNumberToObject(jsonConfig, "potions", m_stressConfig.potionCount);
+    cJSON_AddNumberToObject(jsonConfig, "emitters", m_stressConfig.emitterCount);
+    cJSON_AddNumberToObject(jsonConfig, "tiles", m_stressConfig.tileCount);
+    cJSON_AddNumberToObject(jsonConfig, "widgets", m_stressConfig.widgetCount);
+    cJSON_AddNumberToObject(jsonConfig, "frames", frameCount);
+
+    cJSON *jsonFrame = cJSON_AddObjectToObject(json, "frameMS");
+    cJSON_AddNumberToObject(jsonFrame, "mean", sum / frameCount);
+    cJSON_AddNumberToObject(jsonFrame, "median", sorted[frameCount / 2]);
+    cJSON_AddNumberToObject(jsonFrame, "p95", sorted[std::min(frameCount - 1, frameCount * 95 / 100)]);
+    cJSON_AddNumberToObject(jsonFrame, "max", sorted.back());
+
+    cJSON_AddNumberToObject(json, "meanObjectCount", m_objectCountSum / frameCount);
+    cJSON_AddNumberToObject(json, "meanBodyCount", m_bodyCountSum / frameCount);
+    cJSON_AddNumberToObject(json, "peakMemoryMB", (double)m_peakMemory / (1024.0 * 1024.0));
+    if (AllocTracker::IsEnabled())
+    {
+        cJSON_AddNumberToObject(json, "meanAllocCount", m_allocCountSum / frameCount);
+    }
+
+    // Dure moyenne par frame de chaque zone du profileur
+    cJSON *jsonZones = cJSON_AddObjectToObject(json, "zoneMS");
+    for (const ZoneTotal &total : m_zoneTotals)
+    {
+        cJSON_AddNumberToObject(jsonZones, total.name, total.ms / frameCount);
+    }
+
+    char *str = cJSON_PrintUnformatted(json);
+    AssertNew(str);
+    cJSON_Delete(json);
+
+    std::cout << str << std::endl;
+
+    FILE *file = fopen(m_stressConfig.outPath.c_str(), "ab");
+    if (file)
+    {
+        fprintf(file, "%s\n", str);
+        fclose(file);
+    }
+    else
+    {
+        std::cout << "ERROR - Write stress results " << m_stressConfig.outPath << std::endl;
+    }
+
+    cJSON_free(str);
+}
@@ -0,0 +1,90 @@
+/*
+  Copyright (c) Arnaud BANNIER and Nicolas BODIN.
+  Licensed under the MIT License.
+  See LICENSE.md in the project root for license information.
+*/
+
+#pragma once
+
+#include "GameSettings.h"
+#include "GameCommon.h"
+#include "StageManager.h"
+
+/// @brief Paramtres d'une scne de test de charge.
+class StressConfig
+{
+public:
+    StressConfig();
+
+    /// @brief Lit les options --stress-* de la ligne de commande.
+    /// L'option --stress seule active le test avec les valeurs par dfaut.
+    void ParseArgs(int argc, char *argv[]);
+
+    /// @brief Modifie les configurations des joueurs et du niveau
+    /// pour le test de charge (joueurs contrls par l'ordinateur,
+    /// pas d'objets alatoires ni de fin de partie).
+    void ApplyTo(
+        std::array<PlayerConfig, MAX_PLAYER_COUNT> &playerConfigs,
+        StageConfig &stageConfig) const;
+
+    bool enabled;
+
+    /// @brief Nombre de joueurs contrls par l'ordinateur (au plus MAX_PLAYER_COUNT).
+    int cpuCount;
+    int bombCount;
+    int potionCount;
+    int emitterCount;
+    int tileCount;
+    int widgetCount;
+
+    /// @brief Nombre de frames mesures, aprs les frames de prchauffage.
+    int frameCount;
+    int warmupCount;
+
+    /// @brief Nombre maximal d'allocations par pas fixe aprs le prchauffage
+    /// (ngatif pour ne rien vrifier). Ncessite ALLOC_TRACKING_ENABLED.
+    int fixedStepAllocBudget;
+
+    /// @brief Fichier auquel le rsum est ajout (une ligne JSON par test).
+    std::string outPath;
+};
+
+/// @brief Niveau de test de charge construit sur le StageManager.
+/// Ajoute au niveau un nombre paramtrable d'objets de chaque sous-systme,
+/// mesure les frames puis crit un rsum et quitte le jeu.
+class StressManager : public StageManager
+{
+public:
+    StressManager(
+        InputManager *inputManager,
+        std::array<PlayerConfig, MAX_PLAYER_COUNT> &playerConfigs,
+        StageConfig &stageConfig, const StressConfig &stressConfig);
+    virtual ~StressManager();
+
+    virtual void OnSceneUpdate() override;
+    virtual void OnSceneFixedUpdate() override;
+
+private:
+    struct ZoneTotal
+    {
+        const char *name;
+        double ms;
+    };
+
+    void InitTiles();
+    void InitEmitters();
+    void InitWidgets();
+    void SpawnItems();
+    void RecordFrame();
+    void WriteResults();
+
+    StressConfig m_stressConfig;
+    int m_frameID;
+
+    std::vector<float> m_frameTimes;
+    std::vector<ZoneTotal> m_zoneTotals;
+    double m_objectCountSum;
+    double m_bodyCountSum;
+    double m_allocCountSum;
+    size_t m_peakMemory;
+};
@@ -14,6 +14,9 @@ Terrain::Terrain(Scene *scene, int layer) :
 
     // Couleur des colliders en debug
     m_debugColor.Set(255, 200, 0);
+
+    // Les messages de collision sont traits par les joueurs
+    SetContactEvents(CONTACT_NONE);
 }
 
 Terrain::~Terrain()
@@ -56,12 +59,13 @@ void Terrain::Render()
 
     if (body == nullptr) return;
 
-    const float angle = body->GetAngle() / b2_pi * 180.f;
+    const b2Transform xf = GetInterpolatedTransform();
+    const float angle = xf.q.GetAngle() / b2_pi * 180.f;
     for (Tile &tile : m_tiles)
     {
         if (tile.texture == nullptr) continue;
 
-        b2Vec2 position = body->GetWorldPoint(tile.position);
+        b2Vec2 position = b2Mul(xf, tile.position);
         SDL_FRect dstRect = { 0 };
         camera->WorldToView(position, &tile.srcRect, tile.pixelsPerUnit, dstRect);
 
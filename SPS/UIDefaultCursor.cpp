@@ -26,13 +26,11 @@ UIDefaultCursor::UIDefaultCursor(Scene *scene) :
     Animation *anim = CreateShiftAnimation("Emph", b2Vec2_zero, b2Vec2(-2.f, 0.f));
     anim->SetCycleCount(-1);
     anim->SetCycleTime(1.5f);
-    anim->SetEasing(EasingFct_Cos);
     anim->AddFlags(AnimFlag::ALTERNATE);
 
     anim = CreateAlphaAnimation("Emph", 1.f, 0.5f);
     anim->SetCycleCount(-1);
     anim->SetCycleTime(1.0f);
-    anim->SetEasing(EasingFct_Cos);
     anim->AddFlags(AnimFlag::ALTERNATE);
 
     PlayShiftAnim("Emph");
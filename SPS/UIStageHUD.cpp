@@ -16,7 +16,6 @@ UIStageHUD::UIStageHUD(Scene *scene) :
     AssetManager *assets = scene->GetAssetManager();
     SpriteSheet *spriteSheet = nullptr;
     SpriteGroup *spriteGroup = nullptr;
-    TTF_Font *font = nullptr;
 
 
     
@@ -62,8 +61,9 @@ UIStageHUD::UIStageHUD(Scene *scene) :
         // Compteur des dgats
         
 
-        font = assets->GetFont(FONT_DAMAGE);
-        UIText *text = new UIText(scene, "0%", font, Colors::White);
+        GlyphStrip *glyphs = assets->GetGlyphStrip(FONT_DAMAGE);
+        UIDigitText *text = new UIDigitText(scene, glyphs, Colors::White);
+        text->SetString("0%");
         text->SetAnchor(Anchor::CENTER);
 
         hLayout->AddObject(text, 0, i);
@@ -73,8 +73,9 @@ UIStageHUD::UIStageHUD(Scene *scene) :
 
 
         // Compteur de fall
-        font = assets->GetFont(FONT_NORMAL);     
-        text = new UIText(scene, "0", font, Colors::Gold);    
+        glyphs = assets->GetGlyphStrip(FONT_NORMAL);
+        text = new UIDigitText(scene, glyphs, Colors::Gold);
+        text->SetString("0");
         text->SetAnchor(Anchor::SOUTH);    
 
         hLayout->AddObject(text, 0, i); 
@@ -84,8 +85,8 @@ UIStageHUD::UIStageHUD(Scene *scene) :
     }
 
     // Compteur du temps restant
-    font = assets->GetFont(FONT_TIME);
-    m_timeText = new UIText(scene, "0:00:00", font, Colors::White);
+    m_timeText = new UIDigitText(scene, assets->GetGlyphStrip(FONT_TIME), Colors::White);
+    m_timeText->SetString("0:00:00");
     m_timeText->SetParent(this);
     m_timeText->SetAnchor(Anchor::NORTH_EAST);
     m_timeText->GetLocalRect().offsetMax.Set(-10.f, -10.f);
@@ -104,9 +105,9 @@ void UIStageHUD::Update()
     int minutes = (int)stageManager->GetRemainingTime() / 60;
     int seconds = (int)stageManager->GetRemainingTime() % 60;
     int centiseconds = (int)stageManager->GetRemainingCentiseconds() % 100;
-    char buffer[128] = { 0 };
+    char buffer[UI_DIGIT_TEXT_CAPACITY + 1] = { 0 };
 
-    sprintf_s(buffer, "%d:%02d:%02d", minutes, seconds,centiseconds);
+    snprintf(buffer, sizeof(buffer), "%d:%02d:%02d", minutes, seconds, centiseconds);
     m_timeText->SetString(buffer);
 
     for (int i = 0; i < playerCount; i++)
@@ -118,7 +119,7 @@ void UIStageHUD::Update()
         Color damageColor = player->getDamageColor();
 
         bool isOnEnd = stageManager->IsOnEnd();
-        m_damageTexts[i]->SetString(std::to_string(score) + "%");
+        m_damageTexts[i]->SetInteger(score, "%");
         if (isOnEnd)
         {
            // m_damageTexts[i]->SetOpacity(0); 
@@ -130,7 +131,7 @@ void UIStageHUD::Update()
      
 
         m_damageTexts[i]->SetColor(damageColor);
-        m_fallTexts[i]->SetString(std::to_string(stat->fallCount));
+        m_fallTexts[i]->SetInteger(stat->fallCount);
 
         
     }
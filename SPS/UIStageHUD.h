@@ -17,9 +17,9 @@ public:
     virtual void Update() override;
 
 private:
-    std::vector<UIText *>m_damageTexts;
-    UIText *m_timeText;
-    std::vector<UIText *>m_fallTexts;
+    std::vector<UIDigitText *>m_damageTexts;
+    UIDigitText *m_timeText;
+    std::vector<UIDigitText *>m_fallTexts;
     UIImage* fillImage; 
     UIAnimator* m_animator;
     UIGridLayout* hLayout;
@@ -31,3 +31,14 @@ void UITitleBackground::Render()
         SDL_RenderCopyF(g_renderer, texture, NULL, NULL);
     }
 }
+
+uint64_t UITitleBackground::GetRenderHash()
+{
+    uint64_t hash = UIObject::GetRenderHash();
+    AssetManager *assets = m_scene->GetAssetManager();
+    for (SDL_Texture *texture : assets->GetBackgrounds())
+    {
+        hash = UIHashCombine(hash, (const void *)texture);
+    }
+    return hash;
+}
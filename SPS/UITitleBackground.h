@@ -17,4 +17,5 @@ public:
 
     virtual void Update() override;
     virtual void Render() override;
+    virtual uint64_t GetRenderHash() override;
 };
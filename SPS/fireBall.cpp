@@ -11,7 +11,7 @@
 
 
 fireBall::fireBall(Scene* scene, int s, int playerID) :
-    Damager(scene, LAYER_TERRAIN), m_used(false)
+    Damager(scene, LAYER_TERRAIN), m_used(false), m_animator(scene->GetAnimationSystem())
 {     b2Fixture *m_bodyFixture;
 
 
@@ -21,6 +21,8 @@ fireBall::fireBall(Scene* scene, int s, int playerID) :
     SpriteGroup* spriteGroup = nullptr;
     SpriteAnim* anim = nullptr;
     sens = s;
+    SetParallelFixedUpdate(true);
+    SetContactEvents(CONTACT_ENTER, CATEGORY_ALL_TEAMS);
 
 
     spriteGroup = spriteSheet->GetGroup("fireBall");
@@ -66,12 +68,10 @@ void fireBall::Start()
     fixtureDef.density = 2.f;
     fixtureDef.friction = 1.f;
     fixtureDef.restitution = 0.5f;
-    fixtureDef.filter.maskBits = CATEGORY_PROJECTILE;
+    fixtureDef.filter.categoryBits = CATEGORY_PROJECTILE;
     fixtureDef.filter.maskBits = CATEGORY_ALL_TEAMS;
 
     m_bodyFixture = CreateFixture(&fixtureDef);
-
-    
 }
 
 void fireBall::Render()
@@ -82,7 +82,7 @@ void fireBall::Render()
     if (body == nullptr) return;
 
     // TODO : decommenter  pour afficher la Bomb
-    const float angle = body->GetAngle() / b2_pi * 180.f;
+    const float angle = GetInterpolatedTransform().q.GetAngle() / b2_pi * 180.f;
     SDL_Texture* texture = m_animator.GetTexture();
     if (sens == 1 && texture)
     {
@@ -108,16 +108,11 @@ void fireBall::Render()
     }
 }
 
-void fireBall::FixedUpdate()
+void fireBall::ParallelFixedUpdate(FixedUpdateContext &context)
 {
     //printf("in fireeeeeeeeee\n");
 
-    b2Body* body = GetBody();
-    b2Vec2 velocity = body->GetLinearVelocity();
-    b2Vec2 position = body->GetPosition();
-
-
-    body->SetLinearVelocity(b2Vec2(sens * 20.f, 0.f));
+    context.SetLinearVelocity(this, b2Vec2(sens * 20.f, 0.f));
 }
 
 
@@ -135,9 +130,9 @@ void fireBall::PlaySFXAttak(SoundID  sound)
     assets->PlaySoundFX(sound);
 }
 
-void fireBall::OnCollisionEnter(GameCollision& collision)
+void fireBall::OnCollisionEnter(GameCollision &collision)
 {
-   
+    if (m_used) return;
     
     Player* player = dynamic_cast<Player*>(collision.gameBody);
     if (player)
@@ -150,6 +145,7 @@ void fireBall::OnCollisionEnter(GameCollision& collision)
 
         player->TakeDamage(damage, this);
         
+        m_used = true;
         Delete();
 
     }
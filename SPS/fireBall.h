@@ -22,12 +22,12 @@ public:
 
     virtual void Start() override;
     virtual void Render() override;
-    virtual void FixedUpdate() override;
+    virtual void ParallelFixedUpdate(FixedUpdateContext &context) override;
 
     float timeBeforeExplode;
     virtual void PlaySFXAttak(SoundID sound);
 
-    void OnCollisionEnter(GameCollision& collision);
+    virtual void OnCollisionEnter(GameCollision &collision) override;
 
 
 protected: